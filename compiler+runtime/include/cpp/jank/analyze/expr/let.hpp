@@ -21,11 +21,17 @@ namespace jank::analyze::expr
 
     native_vector<pair_type> pairs;
     do_<E> body;
+    /* A loop* is just a let* which can be the target of a recur. Its body is always analyzed
+     * in tail position, relative to the loop, regardless of where the loop itself is. */
+    native_bool is_loop{};
 
     void propagate_position(expression_position const pos)
     {
       position = pos;
-      body.propagate_position(pos);
+      if(!is_loop)
+      {
+        body.propagate_position(pos);
+      }
     }
 
     object_ptr to_runtime_data() const
@@ -44,6 +50,8 @@ namespace jank::analyze::expr
       return merge(static_cast<expression_base const *>(this)->to_runtime_data(),
                    obj::persistent_array_map::create_unique(make_box("__type"),
                                                             make_box("expr::let"),
+                                                            make_box("is_loop"),
+                                                            make_box(is_loop),
                                                             make_box("pairs"),
                                                             pair_maps,
                                                             make_box("body"),
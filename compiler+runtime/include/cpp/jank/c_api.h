@@ -34,6 +34,21 @@ extern "C"
 
   jank_object_ptr jank_deref(jank_object_ptr o);
 
+  /* Each keyword lookup call site gets one of these. Codegen checks the cached slot
+   * inline, for array maps, and calls into these fns on a miss. */
+  /* NOLINTNEXTLINE(modernize-use-using) */
+  typedef struct
+  {
+    uint64_t slot;
+  } jank_lookup_cache;
+
+  jank_object_ptr
+  jank_lookup_cached(jank_lookup_cache *cache, jank_object_ptr m, jank_object_ptr key);
+  jank_object_ptr jank_lookup_cached_fallback(jank_lookup_cache *cache,
+                                              jank_object_ptr m,
+                                              jank_object_ptr key,
+                                              jank_object_ptr fallback);
+
   jank_object_ptr jank_call0(jank_object_ptr f);
   jank_object_ptr jank_call1(jank_object_ptr f, jank_object_ptr a1);
   jank_object_ptr jank_call2(jank_object_ptr f, jank_object_ptr a1, jank_object_ptr a2);
@@ -122,6 +137,11 @@ extern "C"
   jank_object_ptr jank_vector_create(uint64_t size, ...);
   jank_object_ptr jank_map_create(uint64_t pairs, ...);
   jank_object_ptr jank_set_create(uint64_t size, ...);
+  /* These are used for collection constants, which can be arbitrarily large. */
+  jank_object_ptr jank_list_create_from_array(uint64_t size, jank_object_ptr const *items);
+  jank_object_ptr jank_vector_create_from_array(uint64_t size, jank_object_ptr const *items);
+  jank_object_ptr jank_map_create_from_array(uint64_t pairs, jank_object_ptr const *items);
+  jank_object_ptr jank_set_create_from_array(uint64_t size, jank_object_ptr const *items);
 
   jank_arity_flags jank_function_build_arity_flags(uint8_t highest_fixed_arity,
                                                    jank_native_bool is_variadic,
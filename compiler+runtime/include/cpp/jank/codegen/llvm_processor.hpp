@@ -3,6 +3,7 @@
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/LLVMContext.h>
+#include <llvm/Passes/OptimizationLevel.h>
 #include <llvm/Passes/StandardInstrumentations.h>
 #include <llvm/Analysis/LoopAnalysisManager.h>
 #include <llvm/Analysis/CGSCCPassManager.h>
@@ -30,6 +31,10 @@ namespace jank::codegen
   {
     reusable_context(native_persistent_string const &module_name);
 
+    /* Runs the optimization pipeline for the configured optimization level over every
+     * function in the module. This should only be done once the module is complete. */
+    void optimize() const;
+
     native_persistent_string module_name;
     native_persistent_string ctor_name;
 
@@ -38,6 +43,9 @@ namespace jank::codegen
     std::unique_ptr<llvm::IRBuilder<>> builder;
     llvm::Value *nil{};
     llvm::BasicBlock *global_ctor_block{};
+    /* Collection constants are built from an array of their elements, in the global ctor.
+     * They all share this one, which grows to fit the largest. */
+    llvm::AllocaInst *constant_scratch{};
 
     /* TODO: Is this needed, given lifted constants? */
     native_unordered_map<object_ptr, llvm::Value *, std::hash<object_ptr>, very_equal_to>
@@ -46,7 +54,9 @@ namespace jank::codegen
     native_unordered_map<native_persistent_string, llvm::Value *> c_string_globals;
 
     /* Optimization details. */
+    llvm::OptimizationLevel optimization_level;
     std::unique_ptr<llvm::FunctionPassManager> fpm;
+    std::unique_ptr<llvm::ModulePassManager> mpm;
     std::unique_ptr<llvm::LoopAnalysisManager> lam;
     std::unique_ptr<llvm::FunctionAnalysisManager> fam;
     std::unique_ptr<llvm::CGSCCAnalysisManager> cgam;
@@ -55,6 +65,33 @@ namespace jank::codegen
     std::unique_ptr<llvm::StandardInstrumentations> si;
   };
 
+  /* A recur is a branch back to the header of the innermost loop, or the current fn arity,
+   * with each arg becoming an incoming value for the corresponding phi. */
+  struct recur_target
+  {
+    llvm::BasicBlock *header{};
+    native_vector<llvm::PHINode *> bindings;
+  };
+
+  /* Loops which aren't in tail position can't return from the tail of their body. Instead,
+   * they branch out to an exit block and the value is merged with a phi. */
+  struct tail_target
+  {
+    llvm::BasicBlock *exit{};
+    llvm::PHINode *result{};
+  };
+
+  /* A try which is currently being generated. Exceptions which it doesn't handle are
+   * dispatched to the enclosing try's handler, within the same function, so that its catch
+   * and finally still apply. */
+  struct try_target
+  {
+    llvm::BasicBlock *dispatch{};
+    llvm::PHINode *exception{};
+    llvm::PHINode *selector{};
+    native_bool has_catch{};
+  };
+
   struct llvm_processor
   {
     llvm_processor() = delete;
@@ -72,6 +109,9 @@ namespace jank::codegen
     llvm_processor(llvm_processor &&) noexcept = default;
 
     string_result<void> gen();
+    /* Generates the complete module, without running the optimization pipeline. The
+     * module's context can then be optimized elsewhere, such as on a background thread. */
+    string_result<void> gen_unoptimized();
     llvm::Value *gen(analyze::expression_ptr const &,
                      analyze::expr::function_arity<analyze::expression> const &);
     llvm::Value *gen(analyze::expr::def<analyze::expression> const &,
@@ -115,8 +155,41 @@ namespace jank::codegen
     llvm::Value *gen(analyze::expr::case_<analyze::expression> const &,
                      analyze::expr::function_arity<analyze::expression> const &);
 
+    llvm::Value *gen_loop(analyze::expr::let<analyze::expression> const &,
+                          analyze::expr::function_arity<analyze::expression> const &,
+                          native_unordered_map<obj::symbol_ptr, llvm::Value *> &&old_locals,
+                          native_unordered_map<obj::symbol_ptr, llvm::Value *> &&old_unboxed);
+    llvm::Value *gen_ret(llvm::Value *value) const;
+    static native_bool is_direct_callable(analyze::expr::call<analyze::expression> const &);
+    llvm::Value *gen_direct_call(llvm::SmallVector<llvm::Value *> const &arg_handles,
+                                 llvm::SmallVector<llvm::Type *> const &arg_types);
+    static native_bool is_keyword_lookup(analyze::expr::call<analyze::expression> const &);
+    llvm::Value *gen_keyword_lookup(analyze::expr::call<analyze::expression> const &,
+                                    analyze::expr::function_arity<analyze::expression> const &);
+    llvm::Type *unboxed_type(analyze::expression_ptr const &) const;
+    llvm::Type *unboxed_type(analyze::expr::call<analyze::expression> const &) const;
+    llvm::Type *
+    unboxed_binding_type(analyze::expr::let<analyze::expression> const &,
+                         analyze::expr::let<analyze::expression>::pair_type const &) const;
+    llvm::Value *gen_unboxed(analyze::expression_ptr const &,
+                             analyze::expr::function_arity<analyze::expression> const &);
+    llvm::Value *gen_unboxed(analyze::expr::call<analyze::expression> const &,
+                             analyze::expr::function_arity<analyze::expression> const &);
+    llvm::Value *gen_box(llvm::Value *value) const;
+    native_bool demote_loop_bindings(analyze::expression_ptr const &,
+                                     native_vector<llvm::Type *> &types);
+    native_bool demote_loop_bindings(analyze::expr::do_<analyze::expression> const &,
+                                     native_vector<llvm::Type *> &types);
+    llvm::Constant *gen_exception_type_info() const;
+    llvm::BasicBlock *gen_landing_pad(native_persistent_string const &name,
+                                      native_bool catches,
+                                      try_target const &target) const;
+    void gen_invokes(native_vector<llvm::BasicBlock *> const &blocks,
+                     llvm::BasicBlock *unwind) const;
+    void gen_unwind(llvm::Value *exception, llvm::Value *selector) const;
     llvm::Value *gen_var(obj::symbol_ptr qualified_name) const;
     llvm::Value *gen_c_string(native_persistent_string const &s) const;
+    void gen_profile_call(char const *fn_name, native_persistent_string const &region) const;
 
     native_persistent_string to_string() const;
 
@@ -134,7 +207,9 @@ namespace jank::codegen
     llvm::Value *gen_global(obj::symbol_ptr s);
     llvm::Value *gen_global(obj::keyword_ptr k) const;
     llvm::Value *gen_global(obj::character_ptr c) const;
-    llvm::Value *gen_global_from_read_string(object_ptr o);
+    llvm::Value *gen_global_collection(object_ptr o);
+    llvm::Value *gen_constant(object_ptr o);
+    llvm::Value *gen_constant_scratch(size_t size) const;
     llvm::Value *
     gen_function_instance(analyze::expr::function<analyze::expression> const &expr,
                           analyze::expr::function_arity<analyze::expression> const &fn_arity);
@@ -149,5 +224,13 @@ namespace jank::codegen
     llvm::Function *fn{};
     std::unique_ptr<reusable_context> ctx;
     native_unordered_map<obj::symbol_ptr, llvm::Value *> locals;
+    /* Locals which are known to be native integers, reals, or booleans are kept in
+     * registers, as i64, double, or i1. They're only boxed when they escape. */
+    native_unordered_map<obj::symbol_ptr, llvm::Value *> unboxed_locals;
+    recur_target current_recur;
+    tail_target current_tail;
+    native_vector<try_target> try_targets;
+    /* When profiling, the region for the current arity, which is exited at each return. */
+    native_persistent_string profile_region;
   };
 }
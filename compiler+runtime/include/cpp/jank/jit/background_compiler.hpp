@@ -0,0 +1,104 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <jank/result.hpp>
+#include <jank/runtime/var.hpp>
+
+namespace jank::codegen
+{
+  struct reusable_context;
+}
+
+namespace jank::jit
+{
+  struct processor;
+
+  /* Function definitions make up the bulk of most modules and optimizing them, then
+   * lowering them to machine code, is where most of our load time goes. Since a var can
+   * be left pending until its fn is ready, the IR for each definition can be generated on
+   * the loading thread and then handed off to this pool, which compiles it and links it
+   * into the JIT.
+   *
+   * Running the module's ctor and building the fn touch the runtime, though, and that
+   * happens on whichever thread first needs the var: either something which derefs it, or
+   * the loader, once the module's forms have all been evaluated. */
+  struct background_compiler
+  {
+    background_compiler(processor const &jit_prc, size_t thread_count);
+    background_compiler(background_compiler const &) = delete;
+    background_compiler(background_compiler &&) = delete;
+    ~background_compiler();
+
+    /* The context must hold a complete, unoptimized module for an eval target. Once
+     * compiled, its global ctor is run, then `fn_name` is called and its result becomes
+     * the root of `var`. The var is left pending until then. Any earlier submission for
+     * the same var is superseded by this one. */
+    void submit(std::unique_ptr<codegen::reusable_context> ctx,
+                native_persistent_string const &fn_name,
+                runtime::var_ptr var);
+
+    /* Finishes the latest submission for the var on this thread, waiting for it to be
+     * compiled first. If it couldn't be compiled, or building the fn failed, this throws
+     * and the var is left unbound. Vars which were never submitted are ignored. */
+    void finish(runtime::var const &var);
+
+    /* Identifies everything submitted from this point onward, for `join`. */
+    size_t checkpoint() const;
+
+    /* Finishes everything submitted since the checkpoint, on this thread. Any vars which
+     * failed are left unbound and the errors which haven't already been thrown by `finish`
+     * are reported here. Earlier submissions are left alone. */
+    string_result<void> join(size_t since);
+
+  private:
+    struct task
+    {
+      enum class state : uint8_t
+      {
+        compiling,
+        compiled,
+        finishing,
+        finished,
+        failed
+      };
+
+      std::unique_ptr<codegen::reusable_context> ctx;
+      native_persistent_string ctor_name;
+      native_persistent_string fn_name;
+      runtime::var_ptr var;
+      /* From the var, so a stale submission can never replace a newer root. */
+      size_t generation{};
+      size_t id{};
+      state current{ state::compiling };
+      native_persistent_string error;
+      native_bool reported{};
+    };
+
+    /* The vars are GC allocated, so anything holding tasks needs to be visible to the GC. */
+    using task_ptr = std::shared_ptr<task>;
+
+    void work();
+    string_result<void> compile(task &t) const;
+    string_result<runtime::object_ptr> construct(task const &t) const;
+    void finish(std::unique_lock<std::mutex> &lock, task_ptr const &t);
+    void retire(task_ptr const &t);
+
+    processor const &jit_prc;
+    mutable std::mutex mutex;
+    std::condition_variable task_available;
+    std::condition_variable task_compiled;
+    std::deque<task_ptr, native_allocator<task_ptr>> queue;
+    /* Everything which hasn't finished, or which failed without being reported, in the
+     * order it was submitted. */
+    std::deque<task_ptr, native_allocator<task_ptr>> tasks;
+    native_unordered_map<runtime::var const *, task_ptr> latest;
+    size_t next_id{};
+    native_bool stopping{};
+    native_vector<std::thread> threads;
+  };
+}
@@ -2,6 +2,7 @@
 
 #include <boost/filesystem/path.hpp>
 #include <memory>
+#include <mutex>
 
 #include <clang/Interpreter/Interpreter.h>
 
@@ -13,6 +14,7 @@ namespace llvm
 {
   class Module;
   class LLVMContext;
+  class MemoryBuffer;
 }
 
 namespace clang
@@ -30,6 +32,7 @@ namespace jank::jit
 
     void eval_string(native_persistent_string const &s) const;
     void load_object(native_persistent_string_view const &path) const;
+    void load_object(std::unique_ptr<llvm::MemoryBuffer> buffer) const;
     void load_dynamic_library(native_persistent_string const &path) const;
     void load_ir_module(std::unique_ptr<llvm::Module> m,
                         std::unique_ptr<llvm::LLVMContext> llvm_ctx) const;
@@ -41,6 +44,7 @@ namespace jank::jit
     template <typename T>
     string_result<T> find_symbol(native_persistent_string const &name) const
     {
+      std::lock_guard<std::recursive_mutex> const lock{ mutex };
       if(auto symbol{ interpreter->getSymbolAddress(name.c_str()) })
       {
         return symbol.get().toPtr<T>();
@@ -56,6 +60,10 @@ namespace jank::jit
     option<native_persistent_string> find_dynamic_lib(native_persistent_string const &lib) const;
 
     std::unique_ptr<clang::Interpreter> interpreter;
+    /* The interpreter isn't set up for concurrent compilation, so everything which adds
+     * to it, or looks up from it, is serialized. Background compilation does the expensive
+     * work outside of this and only takes the lock to link the result. */
+    mutable std::recursive_mutex mutex;
     native_integer optimization_level{};
     native_vector<boost::filesystem::path> library_dirs;
   };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <bit>
 
 #include <jank/type.hpp>
@@ -666,13 +667,31 @@ namespace jank
         return store.hash;
       }
 
-      /* https://github.com/openjdk/jdk/blob/7e30130e354ebfed14617effd2a517ab2f4140a5/src/java.base/share/classes/java/lang/StringLatin1.java#L194 */
+      /* https://github.com/openjdk/jdk/blob/7e30130e354ebfed14617effd2a517ab2f4140a5/src/java.base/share/classes/java/lang/StringLatin1.java#L194
+       *
+       * Taking `31 * h + c` eight times over is the same as multiplying h by 31^8 and adding
+       * each char multiplied by its own power of 31. Those multiplications don't depend on
+       * each other, so they can all be done at once, rather than waiting on the previous
+       * char. Everything wraps, so this gives the same result as the byte at a time loop.
+       *
+       * The hash is accumulated locally and stored once, so other threads never see a
+       * partial hash as the cached value. */
       auto const ptr(data());
-      for(size_t i{}; i != size(); ++i)
+      auto const length(size());
+      native_hash h{};
+      size_t i{};
+      for(; i + 8 <= length; i += 8)
       {
-        store.hash = 31 * store.hash + (ptr[i] & 0xff);
+        h = h * hash_powers[8] + byte(ptr[i]) * hash_powers[7] + byte(ptr[i + 1]) * hash_powers[6]
+          + byte(ptr[i + 2]) * hash_powers[5] + byte(ptr[i + 3]) * hash_powers[4]
+          + byte(ptr[i + 4]) * hash_powers[3] + byte(ptr[i + 5]) * hash_powers[2]
+          + byte(ptr[i + 6]) * hash_powers[1] + byte(ptr[i + 7]);
       }
-      return store.hash = hash::integer(store.hash);
+      for(; i != length; ++i)
+      {
+        h = 31 * h + byte(ptr[i]);
+      }
+      return store.hash = hash::integer(h);
     }
 
     /*** Conversions. ***/
@@ -684,6 +703,21 @@ namespace jank
   private:
     static constexpr native_bool is_little_endian{ std::endian::native == std::endian::little };
 
+    /* Powers of 31, from 31^0 to 31^8, wrapped to the size of a hash. */
+    static constexpr std::array<native_hash, 9> hash_powers{ [] {
+      std::array<native_hash, 9> ret{ 1 };
+      for(size_t i{ 1 }; i < ret.size(); ++i)
+      {
+        ret[i] = ret[i - 1] * 31;
+      }
+      return ret;
+    }() };
+
+    static constexpr native_hash byte(value_type const c) noexcept
+    {
+      return static_cast<native_hash>(c & 0xff);
+    }
+
     enum class category : uint8_t
     {
       small = 0,
@@ -1,23 +1,129 @@
 #pragma once
 
+#include <atomic>
+#include <concepts>
+#include <iosfwd>
+
 #include <jank/util/cli.hpp>
 
 namespace jank::profile
 {
+  /* Every region label is interned, so each recorded event only needs a small ID. */
+  using label_id = uint32_t;
+
+  /* The profile output is a binary trace, made up of fixed size records. Labels are written
+   * out once, when they're interned, as a record followed by the label's bytes. Every other
+   * record is an event. Events are buffered per thread and flushed when the buffer fills,
+   * or when the thread exits. */
+  enum class record_kind : uint8_t
+  {
+    enter,
+    exit,
+    report,
+    label
+  };
+
+  struct record
+  {
+    /* Nanoseconds, for events. For labels, it's the label's length. */
+    uint64_t time{};
+    label_id label{};
+    uint16_t thread{};
+    record_kind kind{};
+    uint8_t padding{};
+  };
+
+  static_assert(sizeof(record) == 16);
+
+  /* The first bytes of every trace file. */
+  constexpr native_persistent_string_view trace_magic{ "jankprof" };
+  constexpr uint32_t trace_version{ 1 };
+
+  namespace detail
+  {
+    /* Every region, on every thread, checks this. Nothing else is published through it, so
+     * it's only ever loaded relaxed. */
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    extern std::atomic_bool enabled;
+  }
+
   void configure(util::cli::options const &opts);
-  native_bool is_enabled();
+  /* Flushes every thread's events, prints a summary of the trace to stderr and, if
+   * requested, converts the trace to Chrome's format. Nothing is recorded afterward. */
+  void shutdown();
+
+  inline native_bool is_enabled()
+  {
+    return detail::enabled.load(std::memory_order_relaxed);
+  }
+
+  label_id intern(native_persistent_string_view const &label);
+  /* String literals have static storage, so they can be interned by their address, which
+   * is quicker than hashing their contents. */
+  label_id intern_static(char const *label);
+
+  void enter(label_id label) noexcept;
+  void exit(label_id label) noexcept;
+  void report(label_id label) noexcept;
+
+  /* These intern their labels first, so they're intended for labels which aren't known
+   * until runtime, such as those coming from generated code. */
   void enter(native_persistent_string_view const &region);
   void exit(native_persistent_string_view const &region);
   void report(native_persistent_string_view const &boundary);
 
+  /* Writes out any buffered events for the current thread. */
+  void flush();
+
+  /* Converts a binary trace into the Chrome Trace Event format, which can be loaded into
+   * Perfetto or chrome://tracing. Each thread gets its own track. */
+  string_result<void> write_chrome_trace(std::istream &trace, std::ostream &out);
+  /* Writes a table of the inclusive and exclusive time spent in each region, ordered by
+   * exclusive time. */
+  string_result<void> write_summary(std::istream &trace, std::ostream &out);
+
+  /* A timer is created on many hot paths, so when profiling is disabled, it should cost no
+   * more than a single branch. Labels are either string literals, which are interned once,
+   * or functions which build the label, which are only called when profiling is enabled. */
   struct timer
   {
     timer() = delete;
-    timer(native_persistent_string_view const &region);
-    ~timer();
+
+    template <size_t N>
+    timer(char const (&region)[N])
+    {
+      if(is_enabled()) [[unlikely]]
+      {
+        id = intern_static(region);
+        enter(id);
+      }
+    }
+
+    template <typename F>
+    requires std::invocable<F const &>
+    timer(F const &make_region)
+    {
+      if(is_enabled()) [[unlikely]]
+      {
+        id = intern(make_region());
+        enter(id);
+      }
+    }
+
+    timer(timer const &) = delete;
+    timer(timer &&) = delete;
+
+    ~timer()
+    {
+      if(id) [[unlikely]]
+      {
+        exit(id);
+      }
+    }
 
     void report(native_persistent_string_view const &boundary) const;
 
-    native_persistent_string region;
+    /* Label IDs start at 1, so 0 means this timer isn't recording. */
+    label_id id{};
   };
 }
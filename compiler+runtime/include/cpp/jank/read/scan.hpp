@@ -0,0 +1,26 @@
+#pragma once
+
+#include <jank/native_persistent_string.hpp>
+
+namespace jank::read::scan
+{
+  /* The lexer spends most of its time walking runs of bytes which all fall into the same
+   * class: whitespace between forms, the bodies of symbols and strings, and so on. These
+   * skip over such runs a vector at a time, using AVX2 when the CPU supports it, SSE2
+   * otherwise, and a scalar loop on other architectures.
+   *
+   * Each returns the offset of the first byte, at or after `offset`, which isn't in its
+   * class, or the size of the input if there is none. The classes are deliberately
+   * conservative; anything which isn't plain ASCII ends a run, so the lexer can decode it
+   * and decide for itself. */
+
+  /* Spaces, tabs, newlines, carriage returns, vertical tabs, form feeds, and commas. */
+  size_t skip_whitespace(native_persistent_string_view const &s, size_t offset);
+  /* Printable ASCII which can be part of a symbol or keyword. */
+  size_t skip_symbol(native_persistent_string_view const &s, size_t offset);
+  /* ASCII which can be in a string without needing any attention, meaning everything other
+   * than quotes, backslashes, and null bytes. */
+  size_t skip_string(native_persistent_string_view const &s, size_t offset);
+
+  size_t count_newlines(native_persistent_string_view const &s);
+}
@@ -186,6 +186,18 @@ namespace jank::runtime
         return (arity_flags & 0b01000000);
       }
 
+      /* Determines whether a call with the specified number of args will always land on the
+       * fixed arity with that many params, without any packing of variadic args. This follows
+       * the same rules as `dynamic_call`, which allows codegen to call the arity directly. */
+      static constexpr native_bool
+      is_fixed_arity_call(arity_flag_t const arity_flags, uint8_t const arg_count)
+      {
+        auto const is_variadic(arity_flags & 0b10000000);
+        auto const required_args(arity_flags & 0b00111111);
+        return !is_variadic || arg_count < required_args
+          || (arg_count == required_args && is_variadic_ambiguous(arity_flags));
+      }
+
       static constexpr arity_flag_t build_arity_flags(uint8_t const highest_fixed_arity,
                                                       native_bool const is_variadic,
                                                       native_bool const is_variadic_ambiguous)
@@ -6,4 +6,17 @@ namespace jank::runtime::behavior
   concept derefable = requires(T * const t) {
     { t->deref() } -> std::convertible_to<object_ptr>;
   };
+
+  /* References which may need to wait for their value, such as futures and promises. These
+   * can give up after a timeout, in milliseconds, and return a fallback instead. */
+  template <typename T>
+  concept blocking_derefable = requires(T * const t) {
+    { t->deref(object_ptr{}, object_ptr{}) } -> std::convertible_to<object_ptr>;
+  };
+
+  /* References which don't have their value until some point after they're created. */
+  template <typename T>
+  concept pending = requires(T * const t) {
+    { t->is_realized() } -> std::convertible_to<native_bool>;
+  };
 }
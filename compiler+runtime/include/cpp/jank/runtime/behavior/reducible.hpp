@@ -0,0 +1,66 @@
+#pragma once
+
+#include <jank/runtime/rtti.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/obj/reduced.hpp>
+
+namespace jank::runtime::behavior
+{
+  /* Collections which can reduce over their own elements, without going through a seq. This
+   * is what reduce uses, when it can, and so does everything built on it, such as transduce,
+   * into, and run!. As with reduce, returning a reduced value from f ends the reduction
+   * early, and the value is unwrapped in the result. */
+  template <typename T>
+  concept reducible = requires(T const * const t) {
+    { t->reduce(object_ptr{}, object_ptr{}) } -> std::convertible_to<object_ptr>;
+  };
+
+  /* Associative collections which can pass each key and value to f directly, rather than
+   * building an entry for each. This is what reduce-kv uses. */
+  template <typename T>
+  concept kv_reducible = requires(T const * const t) {
+    { t->reduce_kv(object_ptr{}, object_ptr{}) } -> std::convertible_to<object_ptr>;
+  };
+
+  namespace detail
+  {
+    /* Each returns true when the reduction has been ended by a reduced value, in which case
+     * the accumulator has already been unwrapped. */
+    inline native_bool reduce_step(object_ptr const f, object_ptr &acc, object_ptr const o)
+    {
+      acc = dynamic_call(f, acc, o);
+      if(acc->type == object_type::reduced)
+      {
+        acc = expect_object<obj::reduced>(acc)->val;
+        return true;
+      }
+      return false;
+    }
+
+    inline native_bool
+    reduce_kv_step(object_ptr const f, object_ptr &acc, object_ptr const k, object_ptr const v)
+    {
+      acc = dynamic_call(f, acc, k, v);
+      if(acc->type == object_type::reduced)
+      {
+        acc = expect_object<obj::reduced>(acc)->val;
+        return true;
+      }
+      return false;
+    }
+
+    template <typename It>
+    object_ptr reduce(object_ptr const f, object_ptr const init, It const begin, It const end)
+    {
+      object_ptr acc{ init };
+      for(auto it(begin); it != end; ++it)
+      {
+        if(reduce_step(f, acc, *it))
+        {
+          break;
+        }
+      }
+      return acc;
+    }
+  }
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
 #include <list>
+#include <mutex>
+#include <shared_mutex>
 
 #include <folly/Synchronized.h>
 
@@ -17,6 +20,7 @@ namespace jank
   namespace jit
   {
     struct processor;
+    struct background_compiler;
   }
 
   namespace codegen
@@ -27,6 +31,8 @@ namespace jank
 
 namespace jank::runtime
 {
+  struct executor;
+
   namespace obj
   {
     using keyword_ptr = native_box<struct keyword>;
@@ -115,7 +121,17 @@ namespace jank::runtime
     obj::symbol unique_symbol(native_persistent_string_view const &prefix);
 
     folly::Synchronized<native_unordered_map<obj::symbol_ptr, ns_ptr>> namespaces;
-    folly::Synchronized<native_unordered_map<native_persistent_string, obj::keyword_ptr>> keywords;
+
+    /* Nearly every keyword intern is for a keyword which already exists, from any thread, so
+     * the table is sharded by the hash of the keyword's ns and name. Each shard is searched
+     * under a shared lock and only an insert takes it exclusively. Keywords are kept in
+     * buckets by that hash, so a lookup never needs to build a qualified string. */
+    struct keyword_shard
+    {
+      std::shared_mutex mutex;
+      native_unordered_map<native_hash, native_vector<obj::keyword_ptr>> keywords;
+    };
+    std::array<keyword_shard, 16> keyword_shards;
 
     struct binding_scope
     {
@@ -138,10 +154,35 @@ namespace jank::runtime
     /* TODO: This needs to be synchronized. */
     analyze::processor an_prc{ *this };
     jit::processor jit_prc;
+    /* When enabled, fn definitions are compiled on other threads while we keep evaluating. */
+    std::unique_ptr<jit::background_compiler> background_jit;
+
+    /* The executor's threads are only started once something needs them. */
+    executor &get_executor();
+    /* Contexts are GC allocated and never destroyed, so this needs to be called before
+     * exiting, to stop the executor's threads. */
+    void shutdown_executor();
+    size_t executor_thread_count{};
+    std::unique_ptr<executor> task_executor;
+    std::once_flag task_executor_started;
     /* TODO: This needs to be a dynamic var. */
+    /* While a module is compiled into the compile cache, this collects every module it
+     * requires. */
     native_unordered_map<native_persistent_string, native_vector<native_persistent_string>>
       module_dependencies;
+    native_persistent_string binary_version;
     native_persistent_string binary_cache_dir;
+    /* When the compile cache is enabled, modules loaded from source are also compiled into
+     * this directory. Each object is named by a hash of the module's source and of everything
+     * which affects its compilation, so a matching object can be loaded instead. */
+    option<native_persistent_string> compile_cache_dir;
+    /* Modules which are currently being compiled into the compile cache, mapped to the
+     * object file path which write_module should use for them. These are keyed by the
+     * loader's name for the module, which *current-module* is bound to while compiling it. */
+    native_unordered_map<native_persistent_string, native_persistent_string> compile_cache_targets;
+    /* For each module loaded with the compile cache enabled, a hash of its source and of the
+     * hashes of everything it required. */
+    native_unordered_map<native_persistent_string, native_persistent_string> compile_cache_hashes;
     module::loader module_loader;
 
     var_ptr current_file_var{};
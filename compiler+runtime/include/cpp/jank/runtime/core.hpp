@@ -51,6 +51,8 @@ namespace jank::runtime
 
   native_bool is_callable(object_ptr o);
 
+  native_bool isa(object_ptr hierarchy, object_ptr child, object_ptr parent);
+
   native_hash to_hash(object_ptr o);
 
   object_ptr macroexpand1(object_ptr o);
@@ -85,6 +87,17 @@ namespace jank::runtime
 
   object_ptr force(object_ptr o);
 
+  object_ptr blocking_deref(object_ptr o, object_ptr timeout_ms, object_ptr timeout_val);
+  native_bool is_realized(object_ptr o);
+
+  object_ptr future_call(object_ptr fn);
+  native_bool is_future(object_ptr o);
+  native_bool is_future_done(object_ptr o);
+  native_bool future_cancel(object_ptr o);
+  native_bool is_future_cancelled(object_ptr o);
+  object_ptr promise();
+  object_ptr deliver(object_ptr promise, object_ptr val);
+
   object_ptr tagged_literal(object_ptr tag, object_ptr form);
   native_bool is_tagged_literal(object_ptr o);
 }
@@ -27,25 +27,25 @@ namespace jank::runtime
   [[gnu::always_inline, gnu::flatten, gnu::hot]]
   inline auto make_box(int const i)
   {
-    return make_box<runtime::obj::integer>(static_cast<native_integer>(i));
+    return runtime::obj::integer::create(static_cast<native_integer>(i));
   }
 
   [[gnu::always_inline, gnu::flatten, gnu::hot]]
   inline auto make_box(native_integer const i)
   {
-    return make_box<runtime::obj::integer>(i);
+    return runtime::obj::integer::create(i);
   }
 
   [[gnu::always_inline, gnu::flatten, gnu::hot]]
   inline auto make_box(char const i)
   {
-    return make_box<runtime::obj::character>(i);
+    return runtime::obj::character::create(i);
   }
 
   [[gnu::always_inline, gnu::flatten, gnu::hot]]
   inline auto make_box(size_t const i)
   {
-    return make_box<runtime::obj::integer>(static_cast<native_integer>(i));
+    return runtime::obj::integer::create(static_cast<native_integer>(i));
   }
 
   [[gnu::always_inline, gnu::flatten, gnu::hot]]
@@ -92,7 +92,7 @@ namespace jank::runtime
   [[gnu::always_inline, gnu::flatten, gnu::hot]]
   inline auto make_box(T const d)
   {
-    return make_box<runtime::obj::integer>(d);
+    return runtime::obj::integer::create(static_cast<native_integer>(d));
   }
 
   template <typename T>
@@ -128,6 +128,7 @@ namespace jank::runtime
   size_t sequence_length(object_ptr const s, size_t const max);
 
   object_ptr reduce(object_ptr f, object_ptr init, object_ptr s);
+  object_ptr reduce_kv(object_ptr f, object_ptr init, object_ptr s);
   object_ptr reduced(object_ptr o);
   native_bool is_reduced(object_ptr o);
 
@@ -16,8 +16,10 @@ namespace jank::runtime::detail
   struct native_persistent_array_map
   {
     /* Array maps are fast only for a small number of keys. Clojure JVM uses a threshold of 8
-     * k/v pairs, thus 16 elements. We follow the same. */
-    /* TODO: Benchmark difference thresholds. */
+     * k/v pairs, thus 16 elements. We follow the same. Keyword lookups only compare pointers,
+     * but other keys need to call equal on each key until they find a match, so this mostly
+     * bounds that cost. The "array_map" benchmarks compare lookups and building, across
+     * sizes, against hash maps, for checking this threshold. */
     static constexpr size_t max_size{ 8 };
 
     native_persistent_array_map() = default;
@@ -40,6 +42,8 @@ namespace jank::runtime::detail
     void erase(object_ptr const key);
 
     object_ptr find(object_ptr const key) const;
+    /* The index of the key within data, or the length, if it's not there. */
+    size_t index_of(object_ptr const key) const;
 
     native_hash to_hash() const;
 
@@ -51,7 +51,8 @@ namespace jank::runtime
       = immer::set<object_ptr, std::hash<object_ptr>, object_ptr_equal, memory_policy>;
     using native_transient_hash_set = native_persistent_hash_set::transient_type;
 
-    /* TODO: These BppTree types will leak until we get them GC allocated. */
+    /* BppTree nodes aren't GC allocated, so the objects holding these types need to be
+     * finalized. See `make_box`. */
     using native_persistent_sorted_set
       = bpptree::BppTreeSet<object_ptr, object_ptr_compare>::Persistent;
     using native_transient_sorted_set
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <jank/runtime/object.hpp>
+#include <jank/option.hpp>
+
+namespace jank::runtime
+{
+  /* Runs the tasks behind futures, and everything built on them, such as pmap, on a fixed
+   * set of threads. Each thread has its own queue. Tasks submitted by one of our threads go
+   * on the back of its own queue and it takes from the back, so nested work runs while its
+   * data is still in cache. Idle threads steal the oldest tasks from the front of the other
+   * queues. Tasks submitted from any other thread go on a shared queue, which is stolen
+   * from in the same way.
+   *
+   * The queues hold GC pointers, so the executor is GC allocated, to keep them visible. */
+  struct executor : gc
+  {
+    /* Tasks need to handle their own errors; they must not throw. */
+    struct task
+    {
+      void (*run)(object_ptr){};
+      object_ptr arg{};
+    };
+
+    executor(size_t thread_count);
+    executor(executor const &) = delete;
+    executor(executor &&) = delete;
+    ~executor();
+
+    void submit(task const &t);
+
+    /* Zero means one per core. */
+    static size_t resolve_thread_count(native_integer requested);
+
+    /* Blocking one of our threads takes it out of the pool, so whatever it's waiting on
+     * could be left queued behind it, with nobody free to run it. Blocking derefs wait
+     * through these instead. On our threads, they keep running queued tasks until `done`,
+     * which is checked with the lock held, and sleep until more are submitted when there are
+     * none. Anywhere else, they just wait on `cv`. Whatever makes `done` true needs to call
+     * `notify_helpers`, as well as notifying `cv`. */
+    template <typename Pred>
+    static void wait(std::unique_lock<std::mutex> &lock, std::condition_variable &cv, Pred done)
+    {
+      if(!is_worker_thread())
+      {
+        cv.wait(lock, done);
+        return;
+      }
+
+      while(true)
+      {
+        /* This is read before anything is checked, so a submission or notification which
+         * comes after the checks will wake us. */
+        auto const seen(help_generation());
+        if(done())
+        {
+          return;
+        }
+        if(!help(lock))
+        {
+          sleep(lock, seen);
+        }
+      }
+    }
+
+    template <typename Pred>
+    static native_bool wait_for(std::unique_lock<std::mutex> &lock,
+                                std::condition_variable &cv,
+                                std::chrono::milliseconds const timeout,
+                                Pred done)
+    {
+      if(!is_worker_thread())
+      {
+        return cv.wait_for(lock, timeout, done);
+      }
+
+      auto const deadline(std::chrono::steady_clock::now() + timeout);
+      while(true)
+      {
+        auto const seen(help_generation());
+        if(done())
+        {
+          return true;
+        }
+        if(deadline <= std::chrono::steady_clock::now())
+        {
+          return false;
+        }
+        if(!help(lock))
+        {
+          sleep_until(lock, seen, deadline);
+        }
+      }
+    }
+
+    /* Wakes any of our threads which are sleeping in `wait`, so they check `done` again. */
+    static void notify_helpers();
+
+    /* Runs whatever is already queued and then stops our threads. Anything submitted
+     * afterward is left queued, though futures are still run by whoever derefs them. This
+     * must not be called from one of our own threads. */
+    void shutdown();
+
+    size_t const thread_count{};
+
+  private:
+    static native_bool is_worker_thread();
+    /* Runs one queued task, without holding the lock. Returns whether there was one. */
+    static native_bool help(std::unique_lock<std::mutex> &lock);
+    static size_t help_generation();
+    /* These release the lock until the help generation has moved on from `seen`. */
+    static void sleep(std::unique_lock<std::mutex> &lock, size_t seen);
+    static void sleep_until(std::unique_lock<std::mutex> &lock,
+                            size_t seen,
+                            std::chrono::steady_clock::time_point deadline);
+
+    struct queue
+    {
+      std::mutex mutex;
+      std::deque<task, native_allocator<task>> tasks;
+    };
+
+    option<task> take(size_t index);
+    void work(size_t index);
+
+    /* One for each thread, followed by the shared queue. */
+    std::deque<queue, native_allocator<queue>> queues;
+    native_vector<std::thread> threads;
+    /* Tasks which have been submitted, but not yet taken. Idle threads sleep until this
+     * isn't zero. */
+    std::atomic<size_t> queued{};
+    std::mutex sleep_mutex;
+    std::condition_variable task_available;
+    native_bool stopping{};
+    std::once_flag stopped;
+  };
+}
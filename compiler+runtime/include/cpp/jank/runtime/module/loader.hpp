@@ -95,6 +95,9 @@ namespace jank::runtime::module
 
     loader(context &rt_ctx, native_persistent_string_view const &ps);
 
+    /* Registers the modules within another module path entry. */
+    void add_path(native_persistent_string_view const &path);
+
     string_result<find_result> find(native_persistent_string_view const &module, origin const ori);
     native_bool is_loaded(native_persistent_string_view const &module);
     void set_is_loaded(native_persistent_string_view const &module);
@@ -103,8 +106,12 @@ namespace jank::runtime::module
     string_result<void>
     load_o(native_persistent_string const &module, file_entry const &entry) const;
     string_result<void> load_cpp(file_entry const &entry) const;
-    string_result<void> load_jank(file_entry const &entry) const;
-    string_result<void> load_cljc(file_entry const &entry) const;
+    string_result<void>
+    load_jank(native_persistent_string const &module, file_entry const &entry) const;
+    string_result<void>
+    load_cljc(native_persistent_string const &module, file_entry const &entry) const;
+    string_result<native_bool>
+    load_cached(native_persistent_string const &module, file_entry const &entry) const;
 
     object_ptr to_runtime_data() const;
 
@@ -249,6 +249,15 @@ namespace jank::runtime
     return o;
   }
 
+  namespace detail
+  {
+    template <typename T>
+    void finalize(void * const o, void *)
+    {
+      static_cast<T *>(o)->~T();
+    }
+  }
+
   /* TODO: Constexpr these. */
   template <typename T, typename... Args>
   native_box<T> make_box(Args &&...args)
@@ -275,6 +284,23 @@ namespace jank::runtime
     {
       throw std::runtime_error{ "unable to allocate box" };
     }
+
+    /* The GC doesn't run destructors, which is fine for objects which only hold onto GC
+     * memory. Objects which own memory outside of the GC need their destructors to release
+     * it, though, so they opt in to having them run once they're collected. Finalizers
+     * aren't free, so this should be kept to the objects which need it. */
+    if constexpr(requires { T::needs_finalizer; })
+    {
+      if constexpr(T::needs_finalizer)
+      {
+        GC_register_finalizer_no_order(ret.data,
+                                       &detail::finalize<T>,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr);
+      }
+    }
+
     return ret;
   }
 
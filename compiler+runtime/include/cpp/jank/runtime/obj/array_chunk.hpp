@@ -15,6 +15,9 @@ namespace jank::runtime::obj
     array_chunk(native_vector<object_ptr> const &buffer);
     array_chunk(native_vector<object_ptr> const &buffer, size_t offset);
     array_chunk(native_vector<object_ptr> &&buffer, size_t offset);
+    /* Refers to the given array, rather than copying it. The array needs to be GC allocated,
+     * or otherwise live as long as this chunk, and never be modified. */
+    array_chunk(object_ptr const *data, size_t size, size_t offset);
 
     /* behavior::object_like */
     native_bool equal(object const &) const;
@@ -31,7 +34,11 @@ namespace jank::runtime::obj
     object_ptr nth(object_ptr index, object_ptr fallback) const;
 
     object base{ obj_type };
+    /* When we own our elements, they're in this buffer. Either way, they're accessed
+     * through data. */
     native_vector<object_ptr> buffer;
+    object_ptr const *data{};
+    size_t size{};
     size_t offset{};
   };
 }
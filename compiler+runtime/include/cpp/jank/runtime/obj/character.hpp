@@ -11,6 +11,9 @@ namespace jank::runtime::obj
     static constexpr object_type obj_type{ object_type::character };
     static constexpr native_bool pointer_free{ false };
 
+    /* ASCII characters are cached, much like small integers. */
+    static character_ptr create(char const ch);
+
     character() = default;
     character(character &&) noexcept = default;
     character(character const &) = default;
@@ -24,6 +24,9 @@ namespace jank::runtime::obj
     /* behavior::derefable */
     object_ptr deref();
 
+    /* behavior::pending */
+    native_bool is_realized();
+
     object base{ obj_type };
     object_ptr val{};
     object_ptr fn{};
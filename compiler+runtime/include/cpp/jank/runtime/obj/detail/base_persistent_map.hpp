@@ -50,6 +50,12 @@ namespace jank::runtime::obj::detail
     /* behavior::countable */
     size_t count() const;
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
+    /* behavior::kv_reducible */
+    object_ptr reduce_kv(object_ptr f, object_ptr init) const;
+
     /* behavior::metadatable */
     native_box<PT> with_meta(object_ptr const m) const;
 
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <jank/read/lex.hpp>
+#include <jank/read/parse.hpp>
+#include <jank/runtime/object.hpp>
+#include <jank/util/mapped_file.hpp>
+
+namespace jank::runtime::obj
+{
+  using persistent_string_ptr = native_box<struct persistent_string>;
+  using form_reader_ptr = native_box<struct form_reader>;
+
+  /* Reads forms one at a time, rather than all at once, so that large inputs, such as EDN
+   * logs, can be processed without holding onto every form. Files are mapped, rather than
+   * read into memory, and the pages we've read past are handed back to the OS as we go. */
+  struct form_reader : gc
+  {
+    static constexpr object_type obj_type{ object_type::form_reader };
+    static constexpr native_bool pointer_free{ false };
+    /* Mapped files aren't known to the GC, so they're unmapped by our destructor. */
+    static constexpr native_bool needs_finalizer{ true };
+
+    static constexpr size_t default_release_threshold{ 64 * 1024 * 1024 };
+
+    form_reader(form_reader const &) = delete;
+    form_reader(form_reader &&) = delete;
+    form_reader(native_persistent_string const &path, util::mapped_file &&file);
+    form_reader(persistent_string_ptr source);
+
+    static result<form_reader_ptr, native_persistent_string>
+    open(native_persistent_string const &path);
+
+    /* behavior::object_like */
+    native_bool equal(object const &) const;
+    native_persistent_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    native_persistent_string to_code_string() const;
+    native_hash to_hash() const;
+
+    /* Returns the next form, or `eof` once there are none left. Read errors are thrown. */
+    object_ptr read(object_ptr eof);
+    /* Unmaps the file, after which there's nothing left to read. Readers which are never
+     * closed are closed when they're collected. */
+    void close();
+
+    object base{ obj_type };
+    native_persistent_string path;
+    /* For string readers, this keeps the string alive. */
+    persistent_string_ptr source{};
+    std::unique_ptr<util::mapped_file> file;
+    read::lex::processor lexer;
+    read::parse::processor parser;
+    /* Pages are only released once we're this far past the last release. */
+    size_t release_threshold{ default_release_threshold };
+    /* Everything before this offset has been released. */
+    size_t released{};
+    native_bool closed{};
+    std::mutex mutex;
+  };
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using persistent_hash_map_ptr = native_box<struct persistent_hash_map>;
+  using future_ptr = native_box<struct future>;
+
+  /* Calls fn on the executor, with the thread bindings which were in place when the future
+   * was created. Whichever thread gets to a pending future first runs it; that's usually
+   * an executor thread, but it may be the first thread to deref it. */
+  struct future : gc
+  {
+    static constexpr object_type obj_type{ object_type::future };
+    static constexpr native_bool pointer_free{ false };
+
+    enum class state : uint8_t
+    {
+      pending,
+      running,
+      done,
+      failed,
+      cancelled
+    };
+
+    future() = default;
+    future(object_ptr fn, obj::persistent_hash_map_ptr bindings);
+
+    /* Creates a future and submits it to the runtime's executor. */
+    static future_ptr create(object_ptr fn);
+
+    /* behavior::object_like */
+    native_bool equal(object const &) const;
+    native_persistent_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    native_persistent_string to_code_string() const;
+    native_hash to_hash() const;
+
+    /* behavior::derefable */
+    object_ptr deref();
+
+    /* behavior::blocking_derefable */
+    object_ptr deref(object_ptr timeout_ms, object_ptr timeout_val);
+
+    /* behavior::pending */
+    native_bool is_realized();
+
+    /* Runs fn on this thread, unless it has already been started or cancelled. */
+    void run();
+    /* Only pending futures can be cancelled. Returns whether this one was. */
+    native_bool cancel();
+    native_bool is_cancelled() const;
+
+    object base{ obj_type };
+    object_ptr fn{};
+    obj::persistent_hash_map_ptr bindings{};
+    object_ptr val{};
+    object_ptr error{};
+    std::atomic<state> current{ state::pending };
+    std::mutex mutex;
+    std::condition_variable finished;
+
+  private:
+    /* Must only be called once we're realized. */
+    object_ptr result() const;
+    void finish(state s);
+  };
+}
@@ -73,6 +73,9 @@ namespace jank::runtime::obj
     /* behavior::countable */
     size_t count() const;
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
     object base{ object_type::integer_range };
     integer_ptr start{};
     integer_ptr end{};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include <jank/runtime/object.hpp>
 #include <jank/runtime/behavior/seqable.hpp>
 #include <jank/option.hpp>
@@ -9,7 +11,13 @@ namespace jank::runtime::obj
   using cons_ptr = native_box<struct cons>;
   using lazy_sequence_ptr = native_box<struct lazy_sequence>;
 
-  /* TODO: IPending analog, to implement `realized?`. */
+  /* Lazy seqs may be shared between threads, so realization is synchronized. Once realized,
+   * the seq never changes again, so readers only need to check the state. While realizing,
+   * the state holds the realizing thread, so fn is only ever called once. Other threads wait
+   * for it to finish, but the realizing thread may walk back into this same seq from fn.
+   *
+   * Most lazy seqs are created already realized, by next and friends, so this is kept to a
+   * single word, rather than a lock. */
   struct lazy_sequence : gc
   {
     static constexpr object_type obj_type{ object_type::lazy_sequence };
@@ -17,8 +25,6 @@ namespace jank::runtime::obj
     static constexpr native_bool is_sequential{ true };
 
     lazy_sequence() = default;
-    lazy_sequence(lazy_sequence &&) noexcept = default;
-    lazy_sequence(lazy_sequence const &) = default;
     lazy_sequence(object_ptr fn);
     lazy_sequence(object_ptr fn, object_ptr sequence);
 
@@ -44,16 +50,30 @@ namespace jank::runtime::obj
     /* behavior::metadatable */
     lazy_sequence_ptr with_meta(object_ptr m) const;
 
+    /* behavior::pending */
+    native_bool is_realized() const;
+
   private:
+    static constexpr uintptr_t unrealized_state{ 0 };
+    static constexpr uintptr_t realized_state{ 1 };
+
+    /* Waits until no other thread is realizing us and then makes the current thread the one
+     * realizing us, unless we've been realized already. Returns the state from before. */
+    uintptr_t claim() const;
+    /* Only the outermost claim on a thread stores the next state. */
+    void release(uintptr_t previous, uintptr_t next) const;
+
     object_ptr resolve_fn() const;
     object_ptr resolve_seq() const;
 
   public:
-    /* TODO: Synchronize. */
     object base{ obj_type };
     mutable object_ptr fn{};
     mutable object_ptr fn_result{};
     mutable object_ptr sequence{};
     option<object_ptr> meta;
+    /* Either unrealized, realized, or the token of the thread which is realizing us. It's
+     * only set to realized, with release ordering, once sequence is final. */
+    mutable std::atomic<uintptr_t> state{};
   };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
+#include <shared_mutex>
 
 #include <jank/runtime/object.hpp>
 #include <jank/runtime/behavior/callable.hpp>
@@ -11,6 +12,10 @@ namespace jank::runtime::obj
   using persistent_hash_map_ptr = native_box<struct persistent_hash_map>;
   using multi_function_ptr = native_box<struct multi_function>;
 
+  /* Dispatch is read heavy, so every cache hit is served without taking a lock. The cache is
+   * immutable once published; misses find the best method under a shared lock and then
+   * publish a new cache, with the hierarchy it was built against, under the exclusive lock.
+   * Changes to the methods, preferences, or hierarchy just publish a fresh cache. */
   struct multi_function
     : gc
     , behavior::callable
@@ -70,7 +75,6 @@ namespace jank::runtime::obj
     object_ptr this_object_ptr() final;
 
     multi_function_ptr reset();
-    persistent_hash_map_ptr reset_cache();
     multi_function_ptr add_method(object_ptr dispatch_val, object_ptr method);
     multi_function_ptr remove_method(object_ptr dispatch_val);
     multi_function_ptr prefer_method(object_ptr x, object_ptr y);
@@ -83,15 +87,30 @@ namespace jank::runtime::obj
     object_ptr get_method(object_ptr dispatch_val);
     object_ptr find_and_cache_best_method(object_ptr dispatch_val);
 
+    struct cache : gc
+    {
+      cache(object_ptr hierarchy, persistent_hash_map_ptr methods);
+
+      /* The value of the hierarchy, not the ref holding it. */
+      object_ptr hierarchy{};
+      persistent_hash_map_ptr methods{};
+    };
+
+  private:
+    /* These all require data_lock to be held. */
+    object_ptr find_best_method(object_ptr hierarchy, object_ptr dispatch_val) const;
+    void reset_cache();
+    void publish_cache(object_ptr hierarchy, persistent_hash_map_ptr methods);
+
+  public:
     object base{ obj_type };
     object_ptr dispatch{};
     object_ptr default_dispatch_value{};
     object_ptr hierarchy{};
-    mutable object_ptr cached_hierarchy{};
     persistent_hash_map_ptr method_table{};
-    mutable persistent_hash_map_ptr method_cache{};
+    std::atomic<cache *> method_cache{};
     persistent_hash_map_ptr prefer_table{};
     symbol_ptr name{};
-    std::recursive_mutex data_lock;
+    std::shared_mutex data_lock;
   };
 }
@@ -1,7 +1,18 @@
 #pragma once
 
+#include <array>
+
 #include <jank/runtime/object.hpp>
 
+/* The range of integers which are preallocated, rather than boxed on demand. This can be
+ * configured through CMake. */
+#ifndef JANK_INTEGER_CACHE_MIN
+  #define JANK_INTEGER_CACHE_MIN -128
+#endif
+#ifndef JANK_INTEGER_CACHE_MAX
+  #define JANK_INTEGER_CACHE_MAX 1023
+#endif
+
 namespace jank::runtime::obj
 {
   using boolean_ptr = native_box<struct boolean>;
@@ -43,10 +54,22 @@ namespace jank::runtime::obj
     static constexpr object_type obj_type{ object_type::integer };
     static constexpr native_bool pointer_free{ true };
 
-    integer() = default;
-    integer(integer &&) noexcept = default;
-    integer(integer const &) = default;
-    integer(native_integer const d);
+    /* Small integers are used constantly, as counts, indices, and loop counters. Rather than
+     * allocating a new box for each of them, we keep a preallocated table. */
+    static constexpr native_integer cache_min{ JANK_INTEGER_CACHE_MIN };
+    static constexpr native_integer cache_max{ JANK_INTEGER_CACHE_MAX };
+    static_assert(cache_min <= 0 && 0 <= cache_max);
+
+    static integer_ptr create(native_integer const d);
+
+    constexpr integer() = default;
+    constexpr integer(integer &&) noexcept = default;
+    constexpr integer(integer const &) = default;
+
+    constexpr integer(native_integer const d)
+      : data{ d }
+    {
+    }
 
     /* behavior::object_like */
     native_bool equal(object const &) const;
@@ -69,6 +92,20 @@ namespace jank::runtime::obj
     object base{ obj_type };
   };
 
+  /* The cache is constant initialized, so it's safe to use even from other static
+   * initializers. Since integers are pointer free, there's nothing in it for the GC to
+   * follow. */
+  extern std::array<integer, integer::cache_max - integer::cache_min + 1> integer_cache;
+
+  inline integer_ptr integer::create(native_integer const d)
+  {
+    if(cache_min <= d && d <= cache_max)
+    {
+      return &integer_cache[d - cache_min];
+    }
+    return make_box<integer>(d);
+  }
+
   struct real : gc
   {
     static constexpr object_type obj_type{ object_type::real };
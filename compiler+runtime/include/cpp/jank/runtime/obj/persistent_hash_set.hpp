@@ -59,6 +59,9 @@ namespace jank::runtime::obj
     /* behavior::countable */
     size_t count() const;
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
     /* behavior::conjable */
     persistent_hash_set_ptr conj(object_ptr head) const;
 
@@ -16,6 +16,9 @@ namespace jank::runtime::obj
                                        runtime::detail::native_persistent_sorted_map>
   {
     static constexpr object_type obj_type{ object_type::persistent_sorted_map };
+    /* BppTree nodes aren't GC allocated. They're reference counted, though, so running our
+     * destructor releases the nodes which no other map shares. */
+    static constexpr native_bool needs_finalizer{ true };
 
     using transient_type = transient_sorted_map;
     using parent_type
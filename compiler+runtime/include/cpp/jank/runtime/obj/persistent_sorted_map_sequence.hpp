@@ -1,5 +1,6 @@
 #pragma once
 
+#include <jank/runtime/detail/type.hpp>
 #include <jank/runtime/obj/detail/base_persistent_map_sequence.hpp>
 
 namespace jank::runtime::obj
@@ -12,6 +13,9 @@ namespace jank::runtime::obj
         runtime::detail::native_persistent_sorted_map::const_iterator>
   {
     static constexpr object_type obj_type{ object_type::persistent_sorted_map_sequence };
+    /* Our iterators may hold onto BppTree nodes. */
+    static constexpr native_bool needs_finalizer{ !std::is_trivially_destructible_v<
+      runtime::detail::native_persistent_sorted_map::const_iterator> };
 
     using base_persistent_map_sequence::base_persistent_map_sequence;
   };
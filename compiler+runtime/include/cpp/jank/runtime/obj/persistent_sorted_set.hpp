@@ -14,6 +14,9 @@ namespace jank::runtime::obj
     static constexpr object_type obj_type{ object_type::persistent_sorted_set };
     static constexpr native_bool pointer_free{ false };
     static constexpr native_bool is_set_like{ true };
+    /* BppTree nodes aren't GC allocated. They're reference counted, though, so running our
+     * destructor releases the nodes which no other set shares. */
+    static constexpr native_bool needs_finalizer{ true };
 
     using value_type = runtime::detail::native_persistent_sorted_set;
 
@@ -63,6 +66,9 @@ namespace jank::runtime::obj
     /* behavior::countable */
     size_t count() const;
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
     /* behavior::conjable */
     persistent_sorted_set_ptr conj(object_ptr head) const;
 
@@ -18,6 +18,9 @@ namespace jank::runtime::obj
     static constexpr object_type obj_type{ object_type::persistent_sorted_set_sequence };
     static constexpr native_bool pointer_free{ false };
     static constexpr native_bool is_sequential{ true };
+    /* Our iterators may hold onto BppTree nodes. */
+    static constexpr native_bool needs_finalizer{ !std::is_trivially_destructible_v<
+      runtime::detail::native_persistent_sorted_set::const_iterator> };
 
     persistent_sorted_set_sequence(persistent_sorted_set_sequence &&) noexcept = default;
     persistent_sorted_set_sequence(persistent_sorted_set_sequence const &) = default;
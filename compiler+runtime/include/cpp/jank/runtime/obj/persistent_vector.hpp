@@ -66,6 +66,12 @@ namespace jank::runtime::obj
     /* behavior::countable */
     size_t count() const;
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
+    /* behavior::kv_reducible */
+    object_ptr reduce_kv(object_ptr f, object_ptr init) const;
+
     /* behavior::associatively_readable */
     object_ptr get(object_ptr key) const;
     object_ptr get(object_ptr key, object_ptr fallback) const;
@@ -5,6 +5,7 @@
 namespace jank::runtime::obj
 {
   using cons_ptr = native_box<struct cons>;
+  using array_chunk_ptr = native_box<struct array_chunk>;
   using persistent_vector_ptr = native_box<struct persistent_vector>;
   using persistent_vector_sequence_ptr = native_box<struct persistent_vector_sequence>;
 
@@ -42,6 +43,15 @@ namespace jank::runtime::obj
     /* behavior::sequenceable_in_place */
     persistent_vector_sequence_ptr next_in_place();
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
+    /* behavior::chunkable */
+    /* Chunks line up with the leaves of the vector's tree, so they share its storage. The
+     * first chunk may start part way through a leaf, if this seq does. */
+    obj::array_chunk_ptr chunked_first() const;
+    persistent_vector_sequence_ptr chunked_next() const;
+
     object base{ obj_type };
     obj::persistent_vector_ptr vec{};
     size_t index{};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <condition_variable>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using promise_ptr = native_box<struct promise>;
+
+  struct promise : gc
+  {
+    static constexpr object_type obj_type{ object_type::promise };
+    static constexpr native_bool pointer_free{ false };
+
+    promise() = default;
+
+    /* behavior::object_like */
+    native_bool equal(object const &) const;
+    native_persistent_string to_string() const;
+    void to_string(util::string_builder &buff) const;
+    native_persistent_string to_code_string() const;
+    native_hash to_hash() const;
+
+    /* behavior::derefable */
+    object_ptr deref();
+
+    /* behavior::blocking_derefable */
+    object_ptr deref(object_ptr timeout_ms, object_ptr timeout_val);
+
+    /* behavior::pending */
+    native_bool is_realized();
+
+    /* Only the first delivery has any effect. Returns whether this was it. */
+    native_bool deliver(object_ptr o);
+
+    object base{ obj_type };
+    object_ptr val{};
+    native_bool delivered{};
+    std::mutex mutex;
+    std::condition_variable delivery;
+  };
+}
@@ -40,6 +40,9 @@ namespace jank::runtime::obj
     /* behavior::sequenceable_in_place */
     repeat_ptr next_in_place();
 
+    /* behavior::reducible */
+    object_ptr reduce(object_ptr f, object_ptr init) const;
+
     /* behavior::conjable */
     obj::cons_ptr conj(object_ptr head) const;
 
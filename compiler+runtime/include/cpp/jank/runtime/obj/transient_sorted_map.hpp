@@ -11,6 +11,8 @@ namespace jank::runtime::obj
   {
     static constexpr object_type obj_type{ object_type::transient_sorted_map };
     static constexpr bool pointer_free{ false };
+    /* See persistent_sorted_map. */
+    static constexpr native_bool needs_finalizer{ true };
 
     using value_type = runtime::detail::native_transient_sorted_map;
     using persistent_type_ptr = native_box<struct persistent_sorted_map>;
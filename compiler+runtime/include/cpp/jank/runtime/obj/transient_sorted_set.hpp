@@ -11,6 +11,8 @@ namespace jank::runtime::obj
   {
     static constexpr object_type obj_type{ object_type::transient_sorted_set };
     static constexpr bool pointer_free{ false };
+    /* See persistent_sorted_set. */
+    static constexpr native_bool needs_finalizer{ true };
 
     using value_type = runtime::detail::native_transient_sorted_set;
     using persistent_type_ptr = native_box<struct persistent_sorted_set>;
@@ -31,7 +31,7 @@ namespace jank::runtime
     persistent_vector_sequence,
 
     persistent_array_map,
-    /* TODO: transient_array_map */
+    transient_array_map,
     persistent_array_map_sequence,
 
     persistent_hash_map,
@@ -74,6 +74,8 @@ namespace jank::runtime
     volatile_,
     reduced,
     delay,
+    future,
+    promise,
     ns,
 
     var,
@@ -81,6 +83,8 @@ namespace jank::runtime
     var_unbound_root,
 
     tagged_literal,
+
+    form_reader,
   };
 
   constexpr char const *object_type_str(object_type const type)
@@ -130,6 +134,8 @@ namespace jank::runtime
 
       case object_type::persistent_hash_map:
         return "persistent_hash_map";
+      case object_type::transient_array_map:
+        return "transient_array_map";
       case object_type::transient_hash_map:
         return "transient_hash_map";
       case object_type::persistent_hash_map_sequence:
@@ -200,6 +206,10 @@ namespace jank::runtime
         return "reduced";
       case object_type::delay:
         return "delay";
+      case object_type::future:
+        return "future";
+      case object_type::promise:
+        return "promise";
       case object_type::ns:
         return "ns";
 
@@ -212,6 +222,8 @@ namespace jank::runtime
 
       case object_type::tagged_literal:
         return "tagged_literal";
+      case object_type::form_reader:
+        return "form_reader";
     }
     return "unknown";
   }
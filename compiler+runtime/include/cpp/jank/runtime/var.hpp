@@ -1,8 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
-
-#include <folly/Synchronized.h>
+#include <mutex>
 
 #include <jank/result.hpp>
 #include <jank/runtime/object.hpp>
@@ -52,6 +52,13 @@ namespace jank::runtime
     /* Binding a root changes it for all threads. */
     var_ptr bind_root(object_ptr r);
     object_ptr alter_root(object_ptr f, object_ptr args);
+    /* While a var's root is pending, it's being computed on another thread. Anything which
+     * reads the root will wait for it. Each pending root gets a new generation and only the
+     * latest one may be bound, so a slow computation can't replace a newer one. Binding a
+     * root directly ends the wait and supersedes whatever is pending. */
+    size_t set_pending_root();
+    native_bool is_pending_root() const;
+    native_bool bind_pending_root(object_ptr r, size_t generation);
     /* Setting a var does not change its root, it only affects the current thread
      * binding. If there is no thread binding, a var cannot be set. */
     string_result<void> set(object_ptr r) const;
@@ -75,7 +82,15 @@ namespace jank::runtime
     mutable native_hash hash{};
 
   private:
-    folly::Synchronized<object_ptr> root;
+    object_ptr wait_for_root() const;
+
+    /* Derefs are on the hot path of all generated code, so reading the root is just an
+     * acquire load. Writers still serialize on the mutex, so that alter_root is atomic.
+     * The fn given to alter_root runs while holding it, and that fn may alter or bind this
+     * same var, so it needs to be recursive. A null root means it's pending. */
+    std::atomic<object *> root;
+    std::recursive_mutex root_mutex;
+    size_t pending_generation{};
 
   public:
     std::atomic_bool dynamic{ false };
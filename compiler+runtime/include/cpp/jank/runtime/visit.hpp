@@ -18,6 +18,7 @@
 #include <jank/runtime/obj/persistent_hash_map_sequence.hpp>
 #include <jank/runtime/obj/persistent_sorted_map.hpp>
 #include <jank/runtime/obj/persistent_sorted_map_sequence.hpp>
+#include <jank/runtime/obj/transient_array_map.hpp>
 #include <jank/runtime/obj/transient_hash_map.hpp>
 #include <jank/runtime/obj/transient_sorted_map.hpp>
 #include <jank/runtime/obj/transient_vector.hpp>
@@ -47,8 +48,11 @@
 #include <jank/runtime/obj/atom.hpp>
 #include <jank/runtime/obj/volatile.hpp>
 #include <jank/runtime/obj/delay.hpp>
+#include <jank/runtime/obj/future.hpp>
+#include <jank/runtime/obj/promise.hpp>
 #include <jank/runtime/obj/reduced.hpp>
 #include <jank/runtime/obj/tagged_literal.hpp>
+#include <jank/runtime/obj/form_reader.hpp>
 #include <jank/runtime/ns.hpp>
 #include <jank/runtime/var.hpp>
 #include <jank/runtime/rtti.hpp>
@@ -160,6 +164,11 @@ namespace jank::runtime
                     std::forward<Args>(args)...);
         }
         break;
+      case object_type::transient_array_map:
+        {
+          return fn(expect_object<obj::transient_array_map>(erased), std::forward<Args>(args)...);
+        }
+        break;
       case object_type::transient_hash_map:
         {
           return fn(expect_object<obj::transient_hash_map>(erased), std::forward<Args>(args)...);
@@ -333,6 +342,16 @@ namespace jank::runtime
           return fn(expect_object<obj::delay>(erased), std::forward<Args>(args)...);
         }
         break;
+      case object_type::future:
+        {
+          return fn(expect_object<obj::future>(erased), std::forward<Args>(args)...);
+        }
+        break;
+      case object_type::promise:
+        {
+          return fn(expect_object<obj::promise>(erased), std::forward<Args>(args)...);
+        }
+        break;
       case object_type::ns:
         {
           return fn(expect_object<ns>(erased), std::forward<Args>(args)...);
@@ -358,6 +377,11 @@ namespace jank::runtime
           return fn(expect_object<obj::tagged_literal>(erased), std::forward<Args>(args)...);
         }
         break;
+      case object_type::form_reader:
+        {
+          return fn(expect_object<obj::form_reader>(erased), std::forward<Args>(args)...);
+        }
+        break;
       default:
         {
           util::string_builder sb;
@@ -19,7 +19,14 @@ namespace jank::util::cli
     native_transient_string module_path;
     native_bool profiler_enabled{};
     native_transient_string profiler_file{ "jank.profile" };
+    native_transient_string profiler_format{ "binary" };
     native_bool gc_incremental{};
+    native_integer gc_markers{};
+    native_integer gc_initial_heap{};
+    native_integer gc_max_heap{};
+    native_integer gc_free_space_divisor{};
+    native_bool compile_cache{};
+    native_integer executor_threads{};
 
     /* Native dependencies. */
     native_vector<native_persistent_string> include_dirs;
@@ -29,6 +36,7 @@ namespace jank::util::cli
 
     /* Compilation. */
     native_integer optimization_level{};
+    native_integer jit_threads{};
 
     /* Run command. */
     native_transient_string target_file;
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <jank/util/cli.hpp>
+
+namespace jank::util
+{
+  /* Marker threads are started as soon as the GC is initialized, which needs to happen
+   * before we parse our options, since parsing allocates. So this picks out just
+   * `--gc-markers`, without allocating, and sets the count. Invalid counts are skipped
+   * here, since the full parse will report them. */
+  void configure_gc_markers(int const argc, char const **argv);
+
+  /* Applies the rest of the GC options, once the GC is running, and starts tracking
+   * collections for `gc_stats`. */
+  void configure_gc(cli::options const &opts);
+
+  struct gc_stats
+  {
+    size_t collections{};
+    /* The total, and the longest, time spent within a collection. Without incremental
+     * collection, the world is stopped for all of it. */
+    uint64_t total_pause_ns{};
+    uint64_t max_pause_ns{};
+    size_t heap_bytes{};
+    size_t free_bytes{};
+    size_t unmapped_bytes{};
+    size_t bytes_since_collection{};
+    /* Not including what was allocated since the last collection. */
+    size_t bytes_allocated{};
+    size_t markers{};
+    native_bool incremental{};
+  };
+
+  gc_stats get_gc_stats();
+}
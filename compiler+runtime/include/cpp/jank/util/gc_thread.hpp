@@ -0,0 +1,17 @@
+#pragma once
+
+namespace jank::util
+{
+  /* The GC needs to know about every thread which allocates, or which holds GC pointers
+   * on its stack, so it can scan the stack and stop the thread for a collection. Threads
+   * other than main should hold one of these for as long as they run.
+   *
+   * Before any are created, `GC_allow_register_threads` needs to be called from main. */
+  struct gc_thread_scope
+  {
+    gc_thread_scope();
+    gc_thread_scope(gc_thread_scope const &) = delete;
+    gc_thread_scope(gc_thread_scope &&) = delete;
+    ~gc_thread_scope();
+  };
+}
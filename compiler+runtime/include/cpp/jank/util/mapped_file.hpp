@@ -15,6 +15,12 @@ namespace jank::util
     mapped_file(int const f, char const * const h, size_t const s);
     ~mapped_file();
 
+    /* Lets the OS know we'll read from start to end, so it can read ahead of us. */
+    void advise_sequential() const;
+    /* Hands the pages within this range back to the OS. They're read in again if they're
+     * used later, so this only saves memory when we're done with them. */
+    void release(size_t offset, size_t length) const;
+
     int fd{};
     char const *head{};
     size_t size{};
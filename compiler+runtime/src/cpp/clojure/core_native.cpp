@@ -113,6 +113,11 @@ namespace clojure::core_native
     return make_box<obj::delay>(fn);
   }
 
+  static object_ptr executor_threads()
+  {
+    return make_box(__rt_ctx->executor_thread_count);
+  }
+
   static object_ptr is_fn(object_ptr const o)
   {
     return make_box(o->type == object_type::native_function_wrapper
@@ -387,6 +392,7 @@ jank_object_ptr jank_load_clojure_core_native()
   intern_fn("reduced", &reduced);
   intern_fn("reduced?", &is_reduced);
   intern_fn("reduce", &reduce);
+  intern_fn("reduce-kv", &reduce_kv);
   intern_fn("peek", &peek);
   intern_fn("pop", &pop);
   intern_fn("atom", &atom);
@@ -478,10 +484,21 @@ jank_object_ptr jank_load_clojure_core_native()
   intern_fn("iterate", &iterate);
   intern_fn("delay*", &core_native::delay);
   intern_fn("force", &force);
+  intern_fn("blocking-deref", &blocking_deref);
+  intern_fn("realized?", &is_realized);
+  intern_fn("future-call", &future_call);
+  intern_fn("future?", &is_future);
+  intern_fn("future-done?", &is_future_done);
+  intern_fn("future-cancel", &future_cancel);
+  intern_fn("future-cancelled?", &is_future_cancelled);
+  intern_fn("promise", &promise);
+  intern_fn("deliver", &deliver);
+  intern_fn("executor-threads", &core_native::executor_threads);
   intern_fn("ifn?", &is_callable);
   intern_fn("fn?", &core_native::is_fn);
   intern_fn("multi-fn?", &core_native::is_multi_fn);
   intern_fn("multi-fn*", &core_native::multi_fn);
+  intern_fn("isa?", &isa);
   intern_fn("defmethod*", &core_native::defmethod);
   intern_fn("remove-all-methods", &core_native::remove_all_methods);
   intern_fn("remove-method", &core_native::remove_method);
@@ -0,0 +1,90 @@
+#include <fmt/format.h>
+
+#include <jank/native_persistent_string/fmt.hpp>
+#include <clojure/edn_native.hpp>
+#include <jank/runtime/convert.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/runtime/obj/form_reader.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+
+namespace clojure::edn_native
+{
+  using namespace jank;
+  using namespace jank::runtime;
+
+  static obj::form_reader_ptr expect_reader(object_ptr const o)
+  {
+    if(o->type != object_type::form_reader)
+    {
+      throw std::runtime_error{ fmt::format("expected a reader, not {}", to_code_string(o)) };
+    }
+    return expect_object<obj::form_reader>(o);
+  }
+
+  static object_ptr file_reader(object_ptr const path)
+  {
+    if(path->type != object_type::persistent_string)
+    {
+      throw std::runtime_error{ fmt::format("expected a path, not {}", to_code_string(path)) };
+    }
+    auto reader(obj::form_reader::open(expect_object<obj::persistent_string>(path)->data));
+    if(reader.is_err())
+    {
+      throw std::runtime_error{ reader.expect_err() };
+    }
+    return reader.expect_ok();
+  }
+
+  static object_ptr string_reader(object_ptr const s)
+  {
+    if(s->type != object_type::persistent_string)
+    {
+      throw std::runtime_error{ fmt::format("expected a string, not {}", to_code_string(s)) };
+    }
+    return make_box<obj::form_reader>(expect_object<obj::persistent_string>(s));
+  }
+
+  static object_ptr read(object_ptr const reader, object_ptr const eof)
+  {
+    return expect_reader(reader)->read(eof);
+  }
+
+  static object_ptr close(object_ptr const reader)
+  {
+    expect_reader(reader)->close();
+    return obj::nil::nil_const();
+  }
+
+  static object_ptr is_reader(object_ptr const o)
+  {
+    return make_box(o->type == object_type::form_reader);
+  }
+}
+
+jank_object_ptr jank_load_clojure_edn_native()
+{
+  using namespace jank;
+  using namespace jank::runtime;
+  using namespace clojure;
+
+  auto const ns(__rt_ctx->intern_ns("clojure.edn-native"));
+
+  auto const intern_fn([=](native_persistent_string const &name, auto const fn) {
+    ns->intern_var(name)->bind_root(
+      make_box<obj::native_function_wrapper>(convert_function(fn))
+        ->with_meta(obj::persistent_hash_map::create_unique(std::make_pair(
+          __rt_ctx->intern_keyword("name").expect_ok(),
+          make_box(obj::symbol{ __rt_ctx->current_ns()->to_string(), name }.to_string())))));
+  });
+
+  intern_fn("file-reader", &edn_native::file_reader);
+  intern_fn("string-reader", &edn_native::string_reader);
+  intern_fn("read", &edn_native::read);
+  intern_fn("close", &edn_native::close);
+  intern_fn("reader?", &edn_native::is_reader);
+
+  return erase(obj::nil::nil_const());
+}
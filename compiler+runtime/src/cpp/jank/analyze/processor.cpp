@@ -881,11 +881,9 @@ namespace jank::analyze
                                           meta_source(bindings_obj));
     }
 
-    runtime::detail::native_transient_vector binding_syms, binding_vals;
     for(size_t i{}; i < binding_parts; i += 2)
     {
       auto const &sym_obj(bindings->data[i]);
-      auto const &val(bindings->data[i + 1]);
 
       if(sym_obj->type != runtime::object_type::symbol)
       {
@@ -899,67 +897,61 @@ namespace jank::analyze
         return error::analysis_invalid_loop("'loop' binding symbols must be unqualified",
                                             meta_source(sym_obj));
       }
-
-      binding_syms.push_back(sym_obj);
-      binding_vals.push_back(val);
     }
 
-    /* We take the lazy way out here. Clojure JVM handles loop* with two cases:
-     *
-     * 1. Statements, which expand the loop inline and use labels, gotos, and mutation
-     * 2. Expressions, which wrap the loop in a fn which does the same
-     *
-     * We do something similar to the second, but we transform the loop into just function
-     * recursion and call the function on the spot. It works for both cases, though it's
-     * marginally less efficient.
-     *
-     * However, there's an additional snag. If we just transform the loop into a fn to
-     * call immediately, we get something like this:
-     *
-     * ```
-     * (loop* [a 1
-     *         b 2]
-     *   (println a b))
-     * ```
-     *
-     * Becoming this:
-     *
-     * ```
-     * ((fn* [a b]
-     *   (println a b)) 1 2)
-     * ```
+    /* A loop* is analyzed as a let* which is marked as a loop. Clojure JVM wraps loops which
+     * are in expression position in a fn, but we don't need to. Codegen turns the bindings
+     * into phi nodes in a loop header block and each recur becomes a branch back to that
+     * header. For loops which aren't in tail position, the tail of the body branches out to
+     * an exit block, rather than returning.
      *
-     * This works great, but loop* can actually be used as a let*. That means we can do something
-     * like this:
-     *
-     * ```
-     * (loop* [a 1
-     *         b (* 2 a)]
-     *   (println a b))
-     * ```
-     *
-     * But we can't translate that like the one above, since we'd be referring to `a` before it
-     * was bound. So we get around this by actually just lifting all of this into a let*:
-     *
-     * ```
-     * (let* [a 1
-     *        b (* 2 a)]
-     *   ((fn* [a b]
-     *     (println a b)) a b))
-     * ```
-     */
-    runtime::detail::native_persistent_list const args{ binding_syms.rbegin(),
-                                                        binding_syms.rend() };
-    auto const params(make_box<runtime::obj::persistent_vector>(binding_syms.persistent()));
-    auto const fn(make_box<runtime::obj::persistent_list>(
-      o->data.rest().rest().conj(params).conj(make_box<runtime::obj::symbol>("fn*"))));
-    auto const call(make_box<runtime::obj::persistent_list>(args.conj(fn)));
+     * The bindings are analyzed just like a let*, using the surrounding fn context, since
+     * they can't recur to this loop. We then analyze the body with a new context which
+     * represents the loop, so that recur will check its arg count against the loop's
+     * bindings. */
     auto const let(make_box<runtime::obj::persistent_list>(std::in_place,
                                                            make_box<runtime::obj::symbol>("let*"),
-                                                           bindings_obj,
-                                                           call));
+                                                           bindings_obj));
+    auto let_res(analyze_let(let, current_frame, position, fn_ctx, true));
+    if(let_res.is_err())
+    {
+      return let_res.expect_err_move();
+    }
+
+    auto const ret(let_res.expect_ok_move());
+    auto &loop(boost::get<expr::let<expression>>(ret->data));
+    loop.is_loop = true;
+    loop.needs_box = true;
+    loop.body.position = expression_position::tail;
 
-    return analyze_let(let, current_frame, position, fn_ctx, true);
+    auto loop_ctx(make_box<expr::function_context>());
+    loop_ctx->param_count = binding_parts / 2;
+
+    size_t const form_count{ o->count() - 2 };
+    size_t i{};
+    for(auto const &item : o->data.rest().rest())
+    {
+      auto const is_last(++i == form_count);
+      auto const form_type(is_last ? expression_position::tail : expression_position::statement);
+      auto res(analyze(item,
+                       loop.frame,
+                       form_type,
+                       loop_ctx,
+                       form_type != expression_position::statement));
+      if(res.is_err())
+      {
+        return res.expect_err_move();
+      }
+
+      loop.body.values.emplace_back(res.expect_ok_move());
+    }
+
+    if(loop_ctx->is_tail_recursive)
+    {
+      loop.body = step::force_boxed(std::move(loop.body));
+    }
+
+    return ret;
   }
 
   processor::expression_result
@@ -1563,8 +1555,11 @@ namespace jank::analyze
            * tell us what we need. */
           if(fn_res != vars.end())
           {
+            /* A var can also just alias another fn, such as `inc` aliasing the native one.
+             * Its meta is all we have to go on, then, too. */
             auto const fn(boost::get<expr::function<expression>>(&fn_res->second->data));
-            if(!fn)
+            auto const alias(boost::get<expr::var_deref<expression>>(&fn_res->second->data));
+            if(!fn && !alias)
             {
               return error::internal_analysis_failure("unsupported arity meta on non-function var",
                                                       meta_source(first));
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cstdarg>
 #include <cstdint>
 
@@ -7,6 +8,8 @@
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/core.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
 #include <jank/profile/time.hpp>
 #include <jank/util/scope_exit.hpp>
 
@@ -61,6 +64,35 @@ struct make_function_arity<std::index_sequence<>>
 template <size_t N>
 using function_arity = typename make_function_arity<std::make_index_sequence<N>>::type;
 
+/* The slow path of a keyword lookup. If the map is an array map, we remember where the key
+ * was, since the same call site will very likely see maps with the same shape again.
+ * Keywords are interned, so their identity is enough to find them. */
+static object_ptr lookup_cached(jank_lookup_cache * const cache,
+                                object_ptr const m,
+                                object_ptr const key,
+                                object_ptr const fallback)
+{
+  if(m->type == object_type::persistent_array_map)
+  {
+    auto const &data(expect_object<obj::persistent_array_map>(m)->data);
+    for(size_t i{}; i < data.length; i += 2)
+    {
+      if(data.data[i] == key)
+      {
+        std::atomic_ref<uint64_t>{ cache->slot }.store(i, std::memory_order_relaxed);
+        return data.data[i + 1];
+      }
+    }
+    return fallback;
+  }
+  else if(m->type == object_type::persistent_hash_map)
+  {
+    return expect_object<obj::persistent_hash_map>(m)->get(key, fallback);
+  }
+
+  return get(m, key, fallback);
+}
+
 extern "C"
 {
   jank_object_ptr jank_eval(jank_object_ptr const s)
@@ -117,6 +149,26 @@ extern "C"
     return deref(o_obj);
   }
 
+  jank_object_ptr jank_lookup_cached(jank_lookup_cache * const cache,
+                                     jank_object_ptr const m,
+                                     jank_object_ptr const key)
+  {
+    auto const m_obj(reinterpret_cast<object *>(m));
+    auto const key_obj(reinterpret_cast<object *>(key));
+    return lookup_cached(cache, m_obj, key_obj, obj::nil::nil_const());
+  }
+
+  jank_object_ptr jank_lookup_cached_fallback(jank_lookup_cache * const cache,
+                                              jank_object_ptr const m,
+                                              jank_object_ptr const key,
+                                              jank_object_ptr const fallback)
+  {
+    auto const m_obj(reinterpret_cast<object *>(m));
+    auto const key_obj(reinterpret_cast<object *>(key));
+    auto const fallback_obj(reinterpret_cast<object *>(fallback));
+    return lookup_cached(cache, m_obj, key_obj, fallback_obj);
+  }
+
   jank_object_ptr jank_call0(jank_object_ptr const f)
   {
     auto const f_obj(reinterpret_cast<object *>(f));
@@ -444,7 +496,23 @@ extern "C"
     va_list args{};
     va_start(args, pairs);
 
-    /* TODO: Could optimize to build an array map, if it's small enough. */
+    /* Small maps are built as array maps, like the evaluator does. */
+    if(pairs <= obj::persistent_array_map::max_size)
+    {
+      obj::transient_array_map trans;
+
+      for(uint64_t i{}; i < pairs; ++i)
+      {
+        /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) */
+        trans.assoc_in_place(reinterpret_cast<object *>(va_arg(args, jank_object_ptr)),
+                             /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) */
+                             reinterpret_cast<object *>(va_arg(args, jank_object_ptr)));
+      }
+
+      va_end(args);
+      return erase(trans.to_persistent());
+    }
+
     obj::transient_hash_map trans;
 
     for(uint64_t i{}; i < pairs; ++i)
@@ -477,6 +545,62 @@ extern "C"
     return erase(trans.to_persistent());
   }
 
+  jank_object_ptr jank_list_create_from_array(uint64_t const size, jank_object_ptr const *items)
+  {
+    native_vector<object_ptr> v;
+    v.reserve(size);
+    for(uint64_t i{}; i < size; ++i)
+    {
+      v.emplace_back(reinterpret_cast<object *>(items[i]));
+    }
+
+    runtime::detail::native_persistent_list const npl{ v.rbegin(), v.rend() };
+    return erase(make_box<obj::persistent_list>(std::move(npl)));
+  }
+
+  jank_object_ptr jank_vector_create_from_array(uint64_t const size, jank_object_ptr const *items)
+  {
+    obj::transient_vector trans;
+    for(uint64_t i{}; i < size; ++i)
+    {
+      trans.conj_in_place(reinterpret_cast<object *>(items[i]));
+    }
+    return erase(trans.to_persistent());
+  }
+
+  /* The keys come from a map constant, so they're already known to be unique. */
+  jank_object_ptr jank_map_create_from_array(uint64_t const pairs, jank_object_ptr const *items)
+  {
+    if(pairs <= obj::persistent_array_map::max_size)
+    {
+      runtime::detail::native_persistent_array_map data;
+      for(uint64_t i{}; i < pairs; ++i)
+      {
+        data.insert_unique(reinterpret_cast<object *>(items[i * 2]),
+                           reinterpret_cast<object *>(items[i * 2 + 1]));
+      }
+      return erase(make_box<obj::persistent_array_map>(std::move(data)));
+    }
+
+    obj::transient_hash_map trans;
+    for(uint64_t i{}; i < pairs; ++i)
+    {
+      trans.assoc_in_place(reinterpret_cast<object *>(items[i * 2]),
+                           reinterpret_cast<object *>(items[i * 2 + 1]));
+    }
+    return erase(trans.to_persistent());
+  }
+
+  jank_object_ptr jank_set_create_from_array(uint64_t const size, jank_object_ptr const *items)
+  {
+    obj::transient_hash_set trans;
+    for(uint64_t i{}; i < size; ++i)
+    {
+      trans.conj_in_place(reinterpret_cast<object *>(items[i]));
+    }
+    return erase(trans.to_persistent());
+  }
+
   jank_arity_flags jank_function_build_arity_flags(uint8_t const highest_fixed_arity,
                                                    jank_native_bool const is_variadic,
                                                    jank_native_bool const is_variadic_ambiguous)
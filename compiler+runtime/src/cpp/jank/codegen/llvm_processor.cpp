@@ -1,4 +1,5 @@
 #include <llvm/IR/Verifier.h>
+#include <llvm/Transforms/Utils/Local.h>
 #include <llvm/Transforms/Utils/ModuleUtils.h>
 #include <llvm/TargetParser/Host.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
@@ -23,6 +24,23 @@ namespace jank::codegen
 {
   using namespace jank::analyze;
 
+  static llvm::OptimizationLevel to_optimization_level(native_integer const level)
+  {
+    switch(level)
+    {
+      case 0:
+        return llvm::OptimizationLevel::O0;
+      case 1:
+        return llvm::OptimizationLevel::O1;
+      case 2:
+        return llvm::OptimizationLevel::O2;
+      case 3:
+        return llvm::OptimizationLevel::O3;
+      default:
+        throw std::runtime_error{ fmt::format("invalid optimization level {}", level) };
+    }
+  }
+
   reusable_context::reusable_context(native_persistent_string const &module_name)
     : module_name{ module_name }
     , ctor_name{ runtime::munge(__rt_ctx->unique_string("jank_global_init")) }
@@ -31,14 +49,16 @@ namespace jank::codegen
                                              *llvm_ctx) }
     , builder{ std::make_unique<llvm::IRBuilder<>>(*llvm_ctx) }
     , global_ctor_block{ llvm::BasicBlock::Create(*llvm_ctx, "entry") }
+    , optimization_level{ to_optimization_level(__rt_ctx->jit_prc.optimization_level) }
     , fpm{ std::make_unique<llvm::FunctionPassManager>() }
+    , mpm{ std::make_unique<llvm::ModulePassManager>() }
     , lam{ std::make_unique<llvm::LoopAnalysisManager>() }
     , fam{ std::make_unique<llvm::FunctionAnalysisManager>() }
     , cgam{ std::make_unique<llvm::CGSCCAnalysisManager>() }
     , mam{ std::make_unique<llvm::ModuleAnalysisManager>() }
     , pic{ std::make_unique<llvm::PassInstrumentationCallbacks>() }
     , si{ std::make_unique<llvm::StandardInstrumentations>(*llvm_ctx,
-                                                           /*DebugLogging*/ true) }
+                                                           /*DebugLogging*/ false) }
   {
     /* The LLVM front-end tips documentation suggests setting the target triple and
      * data layout to improve back-end codegen performance. */
@@ -46,25 +66,72 @@ namespace jank::codegen
     module->setDataLayout(
       __rt_ctx->jit_prc.interpreter->getExecutionEngine().get().getDataLayout());
 
-    /* TODO: Configure these passes based on the CLI optimization flag. */
-
-    /* TODO: Add more passes and measure the order of the passes. */
-
     si->registerCallbacks(*pic, mam.get());
 
-    /* Do simple "peephole" optimizations and bit-twiddling optzns. */
-    fpm->addPass(llvm::InstCombinePass());
-    /* Reassociate expressions. */
-    fpm->addPass(llvm::ReassociatePass());
-    /* Eliminate Common SubExpressions. */
-    fpm->addPass(llvm::GVNPass());
-    /* Simplify the control flow graph (deleting unreachable blocks, etc). */
-    fpm->addPass(llvm::SimplifyCFGPass());
+    /* Each pass shows up in the profile, nested within the codegen which ran it, so we can
+     * see where JIT time goes at each optimization level. */
+    if(profile::is_enabled())
+    {
+      pic->registerBeforeNonSkippedPassCallback([](llvm::StringRef const pass, llvm::Any) {
+        profile::enter(fmt::format("llvm pass {}", pass.str()));
+      });
+      pic->registerAfterPassCallback(
+        [](llvm::StringRef const pass, llvm::Any, llvm::PreservedAnalyses const &) {
+          profile::exit(fmt::format("llvm pass {}", pass.str()));
+        });
+      pic->registerAfterPassInvalidatedCallback(
+        [](llvm::StringRef const pass, llvm::PreservedAnalyses const &) {
+          profile::exit(fmt::format("llvm pass {}", pass.str()));
+        });
+    }
 
-    llvm::PassBuilder pb;
+    llvm::PassBuilder pb{ nullptr, llvm::PipelineTuningOptions{}, std::nullopt, pic.get() };
     pb.registerModuleAnalyses(*mam);
+    pb.registerCGSCCAnalyses(*cgam);
     pb.registerFunctionAnalyses(*fam);
+    pb.registerLoopAnalyses(*lam);
     pb.crossRegisterProxies(*lam, *fam, *cgam, *mam);
+
+    /* Without optimizations, we still want to clean up our IR a bit, since it's quite
+     * naive, but we keep this cheap so that JIT latency stays low. This is a pipeline
+     * for each function. */
+    if(optimization_level == llvm::OptimizationLevel::O0)
+    {
+      /* Do simple "peephole" optimizations and bit-twiddling optzns. */
+      fpm->addPass(llvm::InstCombinePass());
+      /* Reassociate expressions. */
+      fpm->addPass(llvm::ReassociatePass());
+      /* Eliminate Common SubExpressions. */
+      fpm->addPass(llvm::GVNPass());
+      /* Simplify the control flow graph (deleting unreachable blocks, etc). */
+      fpm->addPass(llvm::SimplifyCFGPass());
+    }
+    /* Otherwise, we use LLVM's default pipelines, which work on the whole module. This
+     * also allows for inlining across the functions in the module. */
+    else
+    {
+      *mpm = pb.buildPerModuleDefaultPipeline(optimization_level);
+    }
+  }
+
+  void reusable_context::optimize() const
+  {
+    profile::timer const timer{ [&] { return fmt::format("optimize {}", module_name); } };
+
+    if(optimization_level == llvm::OptimizationLevel::O0)
+    {
+      for(auto &fn : *module)
+      {
+        if(!fn.isDeclaration())
+        {
+          fpm->run(fn, *fam);
+        }
+      }
+    }
+    else
+    {
+      mpm->run(*module, *mam);
+    }
   }
 
   llvm_processor::llvm_processor(expression_ptr const &expr,
@@ -124,6 +191,9 @@ namespace jank::codegen
 
     auto const entry(llvm::BasicBlock::Create(*ctx->llvm_ctx, "entry", fn));
     ctx->builder->SetInsertPoint(entry);
+    current_recur = {};
+    current_tail = {};
+    try_targets.clear();
 
     /* JIT loaded object files don't support global ctors, so we need to call our manually.
      * Fortunately, we have our load function which we can hook into. So, if we're compiling
@@ -184,9 +254,52 @@ namespace jank::codegen
                                                          capture.first->name.c_str());
       }
     }
+
+    /* Each arity is a profiling region, entered once, before any recur header, and exited
+     * at every return. */
+    profile_region = {};
+    if(profile::is_enabled())
+    {
+      profile_region = fmt::format("fn {}/{}", root_fn.name, arity.params.size());
+      gen_profile_call("jank_profile_enter", profile_region);
+    }
+
+    /* If this arity recurs, its body goes into a header block with a phi per param. The
+     * entry block only sets up the params and captures, which don't change across
+     * iterations. Each recur then branches back to the header. */
+    if(arity.fn_ctx->is_tail_recursive)
+    {
+      auto const header(llvm::BasicBlock::Create(*ctx->llvm_ctx, "recur", fn));
+      ctx->builder->CreateBr(header);
+      ctx->builder->SetInsertPoint(header);
+
+      current_recur.header = header;
+      current_recur.bindings.reserve(arity.params.size());
+      for(auto const &param : arity.params)
+      {
+        auto const phi(
+          ctx->builder->CreatePHI(ctx->builder->getPtrTy(), 2, param->get_name().c_str()));
+        phi->addIncoming(locals[param], entry);
+        locals[param] = phi;
+        current_recur.bindings.emplace_back(phi);
+      }
+    }
   }
 
   string_result<void> llvm_processor::gen()
+  {
+    auto const res{ gen_unoptimized() };
+    if(res.is_err() || target == compilation_target::function)
+    {
+      return res;
+    }
+
+    /* Nested functions share our module, so this will optimize them as well. */
+    ctx->optimize();
+    return ok();
+  }
+
+  string_result<void> llvm_processor::gen_unoptimized()
   {
     profile::timer const timer{ "ir gen" };
     if(target != compilation_target::function)
@@ -196,7 +309,6 @@ namespace jank::codegen
 
     for(auto const &arity : root_fn.arities)
     {
-      /* TODO: Add profiling to the fn body? Need to exit on every return. */
       create_function(arity);
       for(auto const &form : arity.body.values)
       {
@@ -206,7 +318,7 @@ namespace jank::codegen
       /* If we have an empty function, ensure we're still returning nil. */
       if(arity.body.values.empty())
       {
-        ctx->builder->CreateRet(gen_global(obj::nil::nil_const()));
+        gen_ret(gen_global(obj::nil::nil_const()));
       }
     }
 
@@ -215,9 +327,6 @@ namespace jank::codegen
       //to_string();
     }
 
-    /* Run our optimization passes on the function, mutating it. */
-    ctx->fpm->run(*fn, *ctx->fam);
-
     if(target != compilation_target::function)
     {
       llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
@@ -225,11 +334,7 @@ namespace jank::codegen
 
       if(profile::is_enabled())
       {
-        auto const fn_type(
-          llvm::FunctionType::get(ctx->builder->getVoidTy(), { ctx->builder->getPtrTy() }, false));
-        auto const fn(ctx->module->getOrInsertFunction("jank_profile_exit", fn_type));
-        ctx->builder->CreateCall(fn,
-                                 { gen_c_string(fmt::format("global ctor for {}", root_fn.name)) });
+        gen_profile_call("jank_profile_exit", fmt::format("global ctor for {}", root_fn.name));
       }
 
       ctx->builder->CreateRetVoid();
@@ -284,7 +389,7 @@ namespace jank::codegen
                                 false));
       auto const set_meta_fn(ctx->module->getOrInsertFunction("jank_set_meta", set_meta_fn_type));
 
-      auto const meta(gen_global_from_read_string(expr.name->meta.unwrap()));
+      auto const meta(gen_constant(expr.name->meta.unwrap()));
       ctx->builder->CreateCall(set_meta_fn, { ref, meta });
     }
 
@@ -305,7 +410,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(ref);
+      return gen_ret(ref);
     }
 
     return ref;
@@ -324,7 +429,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
 
     return call;
@@ -337,7 +442,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(var);
+      return gen_ret(var);
     }
 
     return var;
@@ -359,6 +464,32 @@ namespace jank::codegen
   llvm::Value *llvm_processor::gen(expr::call<expression> const &expr,
                                    expr::function_arity<expression> const &arity)
   {
+    /* Primitive math on unboxed values is done natively and only boxed once, here, since
+     * whatever is consuming this call needs a box. */
+    if(unboxed_type(expr))
+    {
+      auto const ret(gen_box(gen_unboxed(expr, arity)));
+
+      if(expr.position == expression_position::tail)
+      {
+        return gen_ret(ret);
+      }
+
+      return ret;
+    }
+
+    if(is_keyword_lookup(expr))
+    {
+      auto const ret(gen_keyword_lookup(expr, arity));
+
+      if(expr.position == expression_position::tail)
+      {
+        return gen_ret(ret);
+      }
+
+      return ret;
+    }
+
     auto const callee(gen(expr.source_expr, arity));
 
     llvm::SmallVector<llvm::Value *> arg_handles;
@@ -375,58 +506,309 @@ namespace jank::codegen
       arg_types.emplace_back(ctx->builder->getPtrTy());
     }
 
-    auto const call_fn_name(arity_to_call_fn(expr.arg_exprs.size()));
+    llvm::Value *call{};
+    if(is_direct_callable(expr))
+    {
+      call = gen_direct_call(arg_handles, arg_types);
+    }
+    else
+    {
+      auto const call_fn_name(arity_to_call_fn(expr.arg_exprs.size()));
+
+      auto const fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), arg_types, false));
+      auto const fn(ctx->module->getOrInsertFunction(call_fn_name.c_str(), fn_type));
+      call = ctx->builder->CreateCall(fn, arg_handles);
+    }
+
+    if(expr.position == expression_position::tail)
+    {
+      return gen_ret(call);
+    }
+
+    return call;
+  }
+
+  /* Our object pointers point to the base field of each object, so all field offsets need
+   * to be relative to that. */
+  template <typename T>
+  static size_t object_field_offset(size_t const field_offset)
+  {
+    return field_offset - offsetof(T, base);
+  }
+
+  static size_t jit_function_arity_offset(size_t const arity)
+  {
+    switch(arity)
+    {
+      case 0:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_0));
+      case 1:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_1));
+      case 2:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_2));
+      case 3:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_3));
+      case 4:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_4));
+      case 5:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_5));
+      case 6:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_6));
+      case 7:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_7));
+      case 8:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_8));
+      case 9:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_9));
+      case 10:
+        return object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_10));
+      default:
+        throw std::runtime_error{ fmt::format("ICE: invalid jit_function arity {}", arity) };
+    }
+  }
+
+  /* A call gets a direct call fast path if its source is a var which, at the time of codegen,
+   * holds a jit_function with a fixed arity matching the call. Since the var may be
+   * redefined later, the fast path is still guarded at runtime. */
+  native_bool llvm_processor::is_direct_callable(expr::call<expression> const &expr)
+  {
+    auto const arg_count(expr.arg_exprs.size());
+    if(runtime::max_params < arg_count)
+    {
+      return false;
+    }
+
+    auto const source(boost::get<expr::var_deref<expression>>(&expr.source_expr->data));
+    if(!source)
+    {
+      return false;
+    }
+
+    /* If the var's fn is still being compiled in the background, we won't wait on it. */
+    if(source->var->is_pending_root())
+    {
+      return false;
+    }
+
+    auto const root(source->var->get_root());
+    if(root->type != object_type::jit_function)
+    {
+      return false;
+    }
+
+    auto const fn(expect_object<obj::jit_function>(root));
+    if(!behavior::callable::is_fixed_arity_call(fn->arity_flags, arg_count))
+    {
+      return false;
+    }
+
+    auto const arity_ptr(reinterpret_cast<object *(**)()>(
+      reinterpret_cast<char *>(&fn->base) + jit_function_arity_offset(arg_count)));
+    return *arity_ptr != nullptr;
+  }
 
+  /* Calls the arity fn of a jit_function directly, avoiding the dynamic dispatch of
+   * jank_call*. We verify that the callee is still a jit_function, that the call won't
+   * need any variadic packing, and that the arity exists. If any of that fails, we fall
+   * back to the normal dynamic call.
+   *
+   * The first arg handle is expected to be the callee. */
+  llvm::Value *
+  llvm_processor::gen_direct_call(llvm::SmallVector<llvm::Value *> const &arg_handles,
+                                  llvm::SmallVector<llvm::Type *> const &arg_types)
+  {
+    auto const callee(arg_handles[0]);
+    auto const arg_count(arg_handles.size() - 1);
+    auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
+    auto const check_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "direct_check", current_fn));
+    auto const direct_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "direct_call", current_fn));
+    auto const dynamic_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "dynamic_call", current_fn));
+    auto const merge_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "call_merge", current_fn));
+
+    /* The object type is the first byte of every object. */
+    auto const type(ctx->builder->CreateLoad(ctx->builder->getInt8Ty(), callee, "type"));
+    auto const is_fn(ctx->builder->CreateICmpEQ(
+      type,
+      ctx->builder->getInt8(static_cast<uint8_t>(object_type::jit_function))));
+    ctx->builder->CreateCondBr(is_fn, check_block, dynamic_block);
+
+    ctx->builder->SetInsertPoint(check_block);
+    auto const flags_ptr(ctx->builder->CreateConstInBoundsGEP1_64(
+      ctx->builder->getInt8Ty(),
+      callee,
+      object_field_offset<obj::jit_function>(offsetof(obj::jit_function, arity_flags))));
+    auto const flags(ctx->builder->CreateLoad(ctx->builder->getInt8Ty(), flags_ptr, "flags"));
+    auto const arg_count_value(ctx->builder->getInt8(arg_count));
+    /* This mirrors callable::is_fixed_arity_call. */
+    auto const not_variadic(
+      ctx->builder->CreateICmpEQ(ctx->builder->CreateAnd(flags, 0b10000000),
+                                 ctx->builder->getInt8(0)));
+    auto const required_args(ctx->builder->CreateAnd(flags, 0b00111111));
+    auto const fewer_args(ctx->builder->CreateICmpULT(arg_count_value, required_args));
+    auto const ambiguous(
+      ctx->builder->CreateAnd(ctx->builder->CreateICmpEQ(arg_count_value, required_args),
+                              ctx->builder->CreateICmpNE(ctx->builder->CreateAnd(flags, 0b01000000),
+                                                         ctx->builder->getInt8(0))));
+    auto const is_fixed(
+      ctx->builder->CreateOr(not_variadic, ctx->builder->CreateOr(fewer_args, ambiguous)));
+    auto const arity_ptr(
+      ctx->builder->CreateConstInBoundsGEP1_64(ctx->builder->getInt8Ty(),
+                                               callee,
+                                               jit_function_arity_offset(arg_count)));
+    auto const arity_fn(ctx->builder->CreateLoad(ctx->builder->getPtrTy(), arity_ptr, "arity"));
+    auto const has_arity(ctx->builder->CreateIsNotNull(arity_fn));
+    ctx->builder->CreateCondBr(ctx->builder->CreateAnd(is_fixed, has_arity),
+                               direct_block,
+                               dynamic_block);
+
+    ctx->builder->SetInsertPoint(direct_block);
+    llvm::SmallVector<llvm::Value *> const direct_args{ arg_handles.begin() + 1,
+                                                        arg_handles.end() };
+    llvm::SmallVector<llvm::Type *> const direct_arg_types{ arg_types.begin() + 1,
+                                                            arg_types.end() };
+    auto const direct_fn_type(
+      llvm::FunctionType::get(ctx->builder->getPtrTy(), direct_arg_types, false));
+    auto const direct_call(ctx->builder->CreateCall(direct_fn_type, arity_fn, direct_args));
+    ctx->builder->CreateBr(merge_block);
+
+    ctx->builder->SetInsertPoint(dynamic_block);
+    auto const call_fn_name(arity_to_call_fn(arg_count));
     auto const fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), arg_types, false));
     auto const fn(ctx->module->getOrInsertFunction(call_fn_name.c_str(), fn_type));
-    auto const call(ctx->builder->CreateCall(fn, arg_handles));
+    auto const dynamic_call(ctx->builder->CreateCall(fn, arg_handles));
+    ctx->builder->CreateBr(merge_block);
+
+    ctx->builder->SetInsertPoint(merge_block);
+    auto const phi(ctx->builder->CreatePHI(ctx->builder->getPtrTy(), 2, "call_tmp"));
+    phi->addIncoming(direct_call, direct_block);
+    phi->addIncoming(dynamic_call, dynamic_block);
+    return phi;
+  }
 
-    if(expr.position == expression_position::tail)
+  static native_bool is_keyword_literal(expression_ptr const &expr)
+  {
+    auto const literal(boost::get<expr::primitive_literal<expression>>(&expr->data));
+    return literal && literal->data->type == object_type::keyword;
+  }
+
+  /* Both (:k m) and (get m :k), with an optional fallback, are keyword lookups. Since the
+   * keyword is constant, each of these call sites gets its own inline cache. */
+  native_bool llvm_processor::is_keyword_lookup(expr::call<expression> const &expr)
+  {
+    auto const arg_count(expr.arg_exprs.size());
+    if(is_keyword_literal(expr.source_expr))
     {
-      return ctx->builder->CreateRet(call);
+      return arg_count == 1 || arg_count == 2;
     }
 
-    return call;
+    auto const source(boost::get<expr::var_deref<expression>>(&expr.source_expr->data));
+    if(!source || source->var->n->name->name != "clojure.core" || source->var->name->name != "get")
+    {
+      return false;
+    }
+    return (arg_count == 2 || arg_count == 3) && is_keyword_literal(expr.arg_exprs[1]);
+  }
+
+  /* Keyword lookups are most often done on small maps, with the same keys in the same
+   * order, so we remember the slot in which we last found the key. If the map is an array
+   * map and that slot still holds our keyword, we can grab the value without any dispatch
+   * or search. Otherwise, we take the slow path, which will update the cache. */
+  llvm::Value *llvm_processor::gen_keyword_lookup(expr::call<expression> const &expr,
+                                                  expr::function_arity<expression> const &arity)
+  {
+    auto const is_get(!is_keyword_literal(expr.source_expr));
+    auto const map(gen(expr.arg_exprs[0], arity));
+    auto const key(is_get ? gen(expr.arg_exprs[1], arity) : gen(expr.source_expr, arity));
+    llvm::Value *fallback{};
+    if(expr.arg_exprs.size() == (is_get ? 3 : 2))
+    {
+      fallback = gen(expr.arg_exprs.back(), arity);
+    }
+
+    auto const cache_type(llvm::StructType::get(*ctx->llvm_ctx, { ctx->builder->getInt64Ty() }));
+    auto const cache(new llvm::GlobalVariable(
+      *ctx->module,
+      cache_type,
+      false,
+      llvm::GlobalVariable::PrivateLinkage,
+      llvm::ConstantStruct::get(cache_type,
+                                { ctx->builder->getInt64(std::numeric_limits<uint64_t>::max()) }),
+      "lookup_cache"));
+
+    auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
+    auto const slot_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "lookup_slot", current_fn));
+    auto const key_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "lookup_key", current_fn));
+    auto const hit_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "lookup_hit", current_fn));
+    auto const miss_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "lookup_miss", current_fn));
+    auto const merge_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "lookup_merge", current_fn));
+
+    auto const type(ctx->builder->CreateLoad(ctx->builder->getInt8Ty(), map, "type"));
+    auto const is_array_map(ctx->builder->CreateICmpEQ(
+      type,
+      ctx->builder->getInt8(static_cast<uint8_t>(object_type::persistent_array_map))));
+    ctx->builder->CreateCondBr(is_array_map, slot_block, miss_block);
+
+    ctx->builder->SetInsertPoint(slot_block);
+    auto const slot(ctx->builder->CreateLoad(ctx->builder->getInt64Ty(), cache, "slot"));
+    slot->setAtomic(llvm::AtomicOrdering::Monotonic);
+    auto const data_offset(
+      object_field_offset<obj::persistent_array_map>(offsetof(obj::persistent_array_map, data)));
+    auto const length_ptr(ctx->builder->CreateConstInBoundsGEP1_64(
+      ctx->builder->getInt8Ty(),
+      map,
+      data_offset + offsetof(runtime::detail::native_persistent_array_map, length)));
+    auto const length(ctx->builder->CreateLoad(ctx->builder->getInt64Ty(), length_ptr, "length"));
+    ctx->builder->CreateCondBr(ctx->builder->CreateICmpULT(slot, length), key_block, miss_block);
+
+    ctx->builder->SetInsertPoint(key_block);
+    auto const data_ptr(ctx->builder->CreateConstInBoundsGEP1_64(
+      ctx->builder->getInt8Ty(),
+      map,
+      data_offset + offsetof(runtime::detail::native_persistent_array_map, data)));
+    auto const data(ctx->builder->CreateLoad(ctx->builder->getPtrTy(), data_ptr, "data"));
+    auto const found_key(ctx->builder->CreateLoad(
+      ctx->builder->getPtrTy(),
+      ctx->builder->CreateInBoundsGEP(ctx->builder->getPtrTy(), data, slot),
+      "found_key"));
+    ctx->builder->CreateCondBr(ctx->builder->CreateICmpEQ(found_key, key), hit_block, miss_block);
+
+    ctx->builder->SetInsertPoint(hit_block);
+    auto const value_index(ctx->builder->CreateAdd(slot, ctx->builder->getInt64(1)));
+    auto const hit(ctx->builder->CreateLoad(
+      ctx->builder->getPtrTy(),
+      ctx->builder->CreateInBoundsGEP(ctx->builder->getPtrTy(), data, value_index),
+      "found_value"));
+    ctx->builder->CreateBr(merge_block);
+
+    ctx->builder->SetInsertPoint(miss_block);
+    llvm::SmallVector<llvm::Value *> args{ cache, map, key };
+    if(fallback)
+    {
+      args.emplace_back(fallback);
+    }
+    llvm::SmallVector<llvm::Type *> const arg_types(args.size(), ctx->builder->getPtrTy());
+    auto const fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), arg_types, false));
+    auto const fn(ctx->module->getOrInsertFunction(
+      fallback ? "jank_lookup_cached_fallback" : "jank_lookup_cached",
+      fn_type));
+    auto const miss(ctx->builder->CreateCall(fn, args));
+    ctx->builder->CreateBr(merge_block);
+
+    ctx->builder->SetInsertPoint(merge_block);
+    auto const phi(ctx->builder->CreatePHI(ctx->builder->getPtrTy(), 2, "lookup_tmp"));
+    phi->addIncoming(hit, hit_block);
+    phi->addIncoming(miss, miss_block);
+    return phi;
   }
 
   llvm::Value *llvm_processor::gen(expr::primitive_literal<expression> const &expr,
                                    expr::function_arity<expression> const &)
   {
-    auto const ret(runtime::visit_object(
-      [&](auto const typed_o) -> llvm::Value * {
-        using T = typename decltype(typed_o)::value_type;
-
-        if constexpr(std::same_as<T, runtime::obj::nil> || std::same_as<T, runtime::obj::boolean>
-                     || std::same_as<T, runtime::obj::integer>
-                     || std::same_as<T, runtime::obj::real> || std::same_as<T, runtime::obj::symbol>
-                     || std::same_as<T, runtime::obj::character>
-                     || std::same_as<T, runtime::obj::keyword>
-                     || std::same_as<T, runtime::obj::persistent_string>
-                     || std::same_as<T, runtime::obj::ratio>)
-        {
-          return gen_global(typed_o);
-        }
-        else if constexpr(std::same_as<T, runtime::obj::persistent_vector>
-                          || std::same_as<T, runtime::obj::persistent_list>
-                          || std::same_as<T, runtime::obj::persistent_hash_set>
-                          || std::same_as<T, runtime::obj::persistent_array_map>
-                          || std::same_as<T, runtime::obj::persistent_hash_map>
-                          /* Cons, etc. */
-                          || runtime::behavior::seqable<T>)
-        {
-          return gen_global_from_read_string(typed_o);
-        }
-        else
-        {
-          throw std::runtime_error{ fmt::format("unimplemented constant codegen: {}\n",
-                                                typed_o->to_string()) };
-        }
-      },
-      expr.data));
+    auto const ret(gen_constant(expr.data));
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(ret);
+      return gen_ret(ret);
     }
 
     return ret;
@@ -453,7 +835,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
 
     return call;
@@ -480,7 +862,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
 
     return call;
@@ -508,7 +890,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
 
     return call;
@@ -535,7 +917,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
 
     return call;
@@ -544,12 +926,21 @@ namespace jank::codegen
   llvm::Value *
   llvm_processor::gen(expr::local_reference const &expr, expr::function_arity<expression> const &)
   {
-    auto const ret(locals[expr.binding.name]);
+    llvm::Value *ret{};
+    auto const unboxed(unboxed_locals.find(expr.binding.name));
+    if(unboxed != unboxed_locals.end())
+    {
+      ret = gen_box(unboxed->second);
+    }
+    else
+    {
+      ret = locals[expr.binding.name];
+    }
     assert(ret);
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(ret);
+      return gen_ret(ret);
     }
 
     return ret;
@@ -576,7 +967,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(fn_obj);
+      return gen_ret(fn_obj);
     }
 
     return fn_obj;
@@ -585,43 +976,39 @@ namespace jank::codegen
   llvm::Value *llvm_processor::gen(expr::recur<expression> const &expr,
                                    expr::function_arity<expression> const &arity)
   {
-    /* The codegen for the special recur form is very similar to the named recursion
-     * codegen, but it's simpler. The key difference is that named recursion requires
-     * arg packing, whereas the special recur form does not. This means, for variadic
-     * functions, the special recur form will be expected to supply a sequence for the
-     * variadic argument. */
-    auto const fn_expr(boost::get<expr::function<expression>>(root_fn.arities[0].fn_ctx->fn->data));
-    auto const is_closure(!fn_expr.captures().empty());
-
-    llvm::SmallVector<llvm::Value *> arg_handles;
-    llvm::SmallVector<llvm::Type *> arg_types;
-    arg_handles.reserve(expr.arg_exprs.size() + is_closure);
-    arg_types.reserve(expr.arg_exprs.size() + is_closure);
-
-    if(is_closure)
+    /* The special recur form doesn't call anything. It rebinds the params of the innermost
+     * loop, or the current fn arity, and jumps back to the top of it. This keeps deep loops
+     * in constant stack space and lets LLVM see them as real loops. Unlike named recursion,
+     * there's no arg packing, so a recur in a variadic fn will be expected to supply a
+     * sequence for the variadic param. */
+    if(!current_recur.header)
     {
-      arg_handles.emplace_back(ctx->builder->GetInsertBlock()->getParent()->getArg(0));
-      arg_types.emplace_back(ctx->builder->getPtrTy());
+      throw std::runtime_error{ "ICE: recur without a loop header" };
     }
 
-    for(auto const &arg_expr : expr.arg_exprs)
+    llvm::SmallVector<llvm::Value *> arg_handles;
+    arg_handles.reserve(expr.arg_exprs.size());
+    for(size_t i{}; i < expr.arg_exprs.size(); ++i)
     {
-      arg_handles.emplace_back(gen(arg_expr, arity));
-      arg_types.emplace_back(ctx->builder->getPtrTy());
+      auto const &arg_expr(expr.arg_exprs[i]);
+      if(current_recur.bindings[i]->getType()->isPointerTy())
+      {
+        arg_handles.emplace_back(gen(arg_expr, arity));
+      }
+      else
+      {
+        arg_handles.emplace_back(gen_unboxed(arg_expr, arity));
+      }
     }
 
-    auto const call_fn_name(
-      fmt::format("{}_{}", munge(fn_expr.unique_name), expr.arg_exprs.size()));
-    auto const fn_type(llvm::FunctionType::get(ctx->builder->getPtrTy(), arg_types, false));
-    auto const fn(ctx->module->getOrInsertFunction(call_fn_name, fn_type));
-    auto const call(ctx->builder->CreateCall(fn, arg_handles));
-
-    if(expr.position == expression_position::tail)
+    /* Generating the args can change the current block, so we only grab it afterward. */
+    auto const current_block(ctx->builder->GetInsertBlock());
+    for(size_t i{}; i < arg_handles.size(); ++i)
     {
-      return ctx->builder->CreateRet(call);
+      current_recur.bindings[i]->addIncoming(arg_handles[i], current_block);
     }
 
-    return call;
+    return ctx->builder->CreateBr(current_recur.header);
   }
 
   llvm::Value *llvm_processor::gen(expr::recursion_reference<expression> const &expr,
@@ -640,7 +1027,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(fn_obj);
+      return gen_ret(fn_obj);
     }
 
     return fn_obj;
@@ -761,7 +1148,7 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
 
     return call;
@@ -771,6 +1158,7 @@ namespace jank::codegen
                                    expr::function_arity<expression> const &arity)
   {
     auto old_locals(locals);
+    auto old_unboxed(unboxed_locals);
     for(auto const &pair : expr.pairs)
     {
       auto const local(expr.frame->find_local_or_capture(pair.first));
@@ -780,18 +1168,136 @@ namespace jank::codegen
                                               pair.first->to_string()) };
       }
 
-      locals[pair.first] = gen(pair.second, arity);
-      locals[pair.first]->setName(pair.first->to_string().c_str());
+      /* Each binding shadows any previous one of the same name, boxed or not. */
+      if(unboxed_binding_type(expr, pair))
+      {
+        auto const value(gen_unboxed(pair.second, arity));
+        value->setName(pair.first->to_string().c_str());
+        unboxed_locals[pair.first] = value;
+        locals.erase(pair.first);
+      }
+      else
+      {
+        locals[pair.first] = gen(pair.second, arity);
+        locals[pair.first]->setName(pair.first->to_string().c_str());
+        unboxed_locals.erase(pair.first);
+      }
+    }
+
+    if(expr.is_loop)
+    {
+      return gen_loop(expr, arity, std::move(old_locals), std::move(old_unboxed));
     }
 
     auto const ret(gen(expr.body, arity));
     locals = std::move(old_locals);
+    unboxed_locals = std::move(old_unboxed);
 
     /* XXX: No return creation, since we rely on the body to do that. */
 
     return ret;
   }
 
+  llvm::Value *
+  llvm_processor::gen_loop(expr::let<expression> const &expr,
+                           expr::function_arity<expression> const &arity,
+                           native_unordered_map<obj::symbol_ptr, llvm::Value *> &&old_locals,
+                           native_unordered_map<obj::symbol_ptr, llvm::Value *> &&old_unboxed)
+  {
+    /* A binding can only stay unboxed across iterations if every recur provides a value of
+     * the same unboxed type. Demoting one binding can change the types of the recur args for
+     * others, so we keep going until nothing changes. */
+    native_vector<llvm::Type *> types;
+    types.reserve(expr.pairs.size());
+    for(auto const &pair : expr.pairs)
+    {
+      auto const unboxed(unboxed_locals.find(pair.first));
+      types.emplace_back(unboxed == unboxed_locals.end() ? nullptr
+                                                         : unboxed->second->getType());
+    }
+
+    auto const initial_unboxed(unboxed_locals);
+    native_bool changed{ true };
+    while(changed)
+    {
+      for(size_t i{}; i < expr.pairs.size(); ++i)
+      {
+        if(types[i])
+        {
+          unboxed_locals[expr.pairs[i].first] = llvm::PoisonValue::get(types[i]);
+        }
+        else
+        {
+          unboxed_locals.erase(expr.pairs[i].first);
+        }
+      }
+      changed = demote_loop_bindings(expr.body, types);
+    }
+    unboxed_locals = initial_unboxed;
+
+    /* Anything which was demoted needs to be boxed before we enter the loop. */
+    for(size_t i{}; i < expr.pairs.size(); ++i)
+    {
+      auto const &name(expr.pairs[i].first);
+      if(!types[i] && unboxed_locals.contains(name))
+      {
+        locals[name] = gen_box(unboxed_locals[name]);
+        unboxed_locals.erase(name);
+      }
+    }
+
+    auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
+    auto const preheader(ctx->builder->GetInsertBlock());
+    auto const header(llvm::BasicBlock::Create(*ctx->llvm_ctx, "loop", current_fn));
+    ctx->builder->CreateBr(header);
+    ctx->builder->SetInsertPoint(header);
+
+    auto old_recur(std::move(current_recur));
+    current_recur = { header, {} };
+    current_recur.bindings.reserve(expr.pairs.size());
+    for(size_t i{}; i < expr.pairs.size(); ++i)
+    {
+      auto const &name(expr.pairs[i].first);
+      auto &bindings(types[i] ? unboxed_locals : locals);
+      auto const phi(ctx->builder->CreatePHI(types[i] ? types[i] : ctx->builder->getPtrTy(),
+                                             2,
+                                             name->to_string().c_str()));
+      phi->addIncoming(bindings[name], preheader);
+      bindings[name] = phi;
+      current_recur.bindings.emplace_back(phi);
+    }
+
+    /* The body is always in tail position, relative to the loop. If the loop itself isn't
+     * in tail position, the body's tail values flow into an exit block instead. A loop in
+     * tail position just inherits the current tail target, which may belong to an outer
+     * loop. */
+    auto const is_return(expr.position == expression_position::tail);
+    auto const old_tail(current_tail);
+    if(!is_return)
+    {
+      auto const exit(llvm::BasicBlock::Create(*ctx->llvm_ctx, "loop_exit"));
+      current_tail = { exit,
+                       llvm::PHINode::Create(ctx->builder->getPtrTy(), 2, "loop_tmp", exit) };
+    }
+
+    auto const body(gen(expr.body, arity));
+
+    llvm::Value *ret{ body };
+    if(!is_return)
+    {
+      current_fn->insert(current_fn->end(), current_tail.exit);
+      ctx->builder->SetInsertPoint(current_tail.exit);
+      ret = current_tail.result;
+    }
+
+    current_tail = old_tail;
+    current_recur = std::move(old_recur);
+    locals = std::move(old_locals);
+    unboxed_locals = std::move(old_unboxed);
+
+    return ret;
+  }
+
   llvm::Value *llvm_processor::gen(expr::do_<expression> const &expr,
                                    expr::function_arity<expression> const &arity)
   {
@@ -812,7 +1318,7 @@ namespace jank::codegen
         {
           if(expr.values.empty())
           {
-            return ctx->builder->CreateRet(gen_global(obj::nil::nil_const()));
+            return gen_ret(gen_global(obj::nil::nil_const()));
           }
           else
           {
@@ -830,13 +1336,24 @@ namespace jank::codegen
      * for us. Since LLVM basic blocks can only have one terminating instruction, we need
      * to take care to not generate our own, too. */
     auto const is_return(expr.position == expression_position::tail);
-    auto const condition(gen(expr.condition, arity));
-    auto const truthy_fn_type(
-      llvm::FunctionType::get(ctx->builder->getInt8Ty(), { ctx->builder->getPtrTy() }, false));
-    auto const fn(ctx->module->getOrInsertFunction("jank_truthy", truthy_fn_type));
-    llvm::SmallVector<llvm::Value *, 1> const args{ condition };
-    auto const call(ctx->builder->CreateCall(fn, args));
-    auto const cmp(ctx->builder->CreateICmpEQ(call, ctx->builder->getInt8(1), "iftmp"));
+
+    /* Unboxed comparisons give us an i1 which can be branched on without any truthiness
+     * check. */
+    llvm::Value *cmp{};
+    if(unboxed_type(expr.condition) == ctx->builder->getInt1Ty())
+    {
+      cmp = gen_unboxed(expr.condition, arity);
+    }
+    else
+    {
+      auto const condition(gen(expr.condition, arity));
+      auto const truthy_fn_type(
+        llvm::FunctionType::get(ctx->builder->getInt8Ty(), { ctx->builder->getPtrTy() }, false));
+      auto const fn(ctx->module->getOrInsertFunction("jank_truthy", truthy_fn_type));
+      llvm::SmallVector<llvm::Value *, 1> const args{ condition };
+      auto const call(ctx->builder->CreateCall(fn, args));
+      cmp = ctx->builder->CreateICmpEQ(call, ctx->builder->getInt8(1), "iftmp");
+    }
 
     auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
     auto then_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "then", current_fn));
@@ -869,7 +1386,7 @@ namespace jank::codegen
       else_ = gen_global(obj::nil::nil_const());
       if(expr.position == expression_position::tail)
       {
-        else_ = ctx->builder->CreateRet(else_);
+        else_ = gen_ret(else_);
       }
     }
 
@@ -912,49 +1429,223 @@ namespace jank::codegen
 
     if(expr.position == expression_position::tail)
     {
-      return ctx->builder->CreateRet(call);
+      return gen_ret(call);
     }
     return call;
   }
 
+  /* A try is generated inline, using the same zero-cost exception handling as C++. Any call
+   * within the try body becomes an invoke which unwinds to a landing pad, so nothing extra
+   * happens unless something is thrown. The landing pad dispatches on the exception type,
+   * to either the catch or to the unhandled block, which runs the finally and keeps
+   * unwinding.
+   *
+   * Both the body and the catch produce their value through the try's merge block, just
+   * like a loop which isn't in tail position. The finally is generated once and shared by
+   * the normal and exceptional paths, with a phi to know which one we're on. */
   llvm::Value *llvm_processor::gen(expr::try_<expression> const &expr,
                                    expr::function_arity<expression> const &arity)
   {
-    auto const wrapped_body(
-      evaluate::wrap_expression(make_box<expression>(expr.body), "try_body", {}));
-    auto const wrapped_catch(expr.catch_body.map([](auto const &catch_body) {
-      return evaluate::wrap_expression(make_box<expression>(catch_body.body),
-                                       "catch",
-                                       { catch_body.sym });
-    }));
-    auto const wrapped_finally(expr.finally_body.map([](auto const &finally) {
-      return evaluate::wrap_expression(make_box<expression>(finally), "finally", {});
-    }));
-
-    auto const body(gen(wrapped_body, arity));
-    auto const catch_(
-      wrapped_catch.map([&](auto const &catch_body) { return gen(catch_body, arity); }));
-    auto const finally(
-      wrapped_finally.map([&](auto const &finally) { return gen(finally, arity); }));
-
-    auto const fn_type(llvm::FunctionType::get(
-      ctx->builder->getPtrTy(),
-      { ctx->builder->getPtrTy(), ctx->builder->getPtrTy(), ctx->builder->getPtrTy() },
-      false));
-    auto const fn(ctx->module->getOrInsertFunction("jank_try", fn_type));
-
-    llvm::SmallVector<llvm::Value *, 3> const args{
-      body,
-      catch_.unwrap_or(gen_global(obj::nil::nil_const())),
-      finally.unwrap_or(gen_global(obj::nil::nil_const()))
-    };
-    auto const call(ctx->builder->CreateCall(fn, args));
+    auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
+    auto const is_return(expr.position == expression_position::tail);
+    auto const has_catch(expr.catch_body.is_some());
+    auto const has_finally(expr.finally_body.is_some());
+    auto const nil(gen_global(obj::nil::nil_const()));
 
-    if(expr.position == expression_position::tail)
+    if(!current_fn->hasPersonalityFn())
     {
-      return ctx->builder->CreateRet(call);
+      auto const personality_type(llvm::FunctionType::get(ctx->builder->getInt32Ty(), true));
+      auto const personality(
+        ctx->module->getOrInsertFunction("__gxx_personality_v0", personality_type));
+      current_fn->setPersonalityFn(llvm::cast<llvm::Constant>(personality.getCallee()));
     }
-    return call;
+
+    /* Any enclosing catch needs to be known to the unwinder now, since we're the ones
+     * who'll be dispatching to it. */
+    native_bool outer_catches{};
+    for(auto const &outer : try_targets)
+    {
+      outer_catches |= outer.has_catch;
+    }
+    auto const catches(has_catch || outer_catches);
+
+    auto const dispatch_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "try_dispatch"));
+    auto const unhandled_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "try_unhandled"));
+    try_target const target{
+      dispatch_block,
+      llvm::PHINode::Create(ctx->builder->getPtrTy(), 1, "exception", dispatch_block),
+      llvm::PHINode::Create(ctx->builder->getInt32Ty(), 1, "selector", dispatch_block),
+      has_catch
+    };
+    try_target const unhandled_target{
+      unhandled_block,
+      llvm::PHINode::Create(ctx->builder->getPtrTy(), 2, "exception", unhandled_block),
+      llvm::PHINode::Create(ctx->builder->getInt32Ty(), 2, "selector", unhandled_block),
+      false
+    };
+
+    auto const old_tail(current_tail);
+    auto const merge_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "try_merge"));
+    current_tail = { merge_block,
+                     llvm::PHINode::Create(ctx->builder->getPtrTy(), 2, "try_tmp", merge_block) };
+
+    /* Everything generated from here, until the end of the body, is within the try. */
+    native_vector<llvm::BasicBlock *> existing_blocks;
+    for(auto &block : *current_fn)
+    {
+      existing_blocks.emplace_back(&block);
+    }
+    auto const new_blocks_since([&](native_vector<llvm::BasicBlock *> const &existing) {
+      native_vector<llvm::BasicBlock *> ret;
+      for(auto &block : *current_fn)
+      {
+        if(std::find(existing.begin(), existing.end(), &block) == existing.end())
+        {
+          ret.emplace_back(&block);
+        }
+      }
+      return ret;
+    });
+
+    auto const body_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "try_body", current_fn));
+    ctx->builder->CreateBr(body_block);
+    ctx->builder->SetInsertPoint(body_block);
+
+    try_targets.emplace_back(target);
+    auto const body(gen(expr.body, arity));
+    if(!is_return)
+    {
+      gen_ret(body ? body : nil);
+    }
+    try_targets.pop_back();
+
+    auto const body_blocks(new_blocks_since(existing_blocks));
+    gen_invokes(body_blocks, gen_landing_pad("try_pad", catches, target));
+
+    current_fn->insert(current_fn->end(), dispatch_block);
+    ctx->builder->SetInsertPoint(dispatch_block);
+    if(has_catch)
+    {
+      auto const &catch_body(expr.catch_body.unwrap());
+      auto const catch_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "catch", current_fn));
+
+      auto const type_id(ctx->builder->CreateIntrinsic(llvm::Intrinsic::eh_typeid_for,
+                                                       { ctx->builder->getPtrTy() },
+                                                       { gen_exception_type_info() }));
+      auto const matches(ctx->builder->CreateICmpEQ(target.selector, type_id));
+      ctx->builder->CreateCondBr(matches, catch_block, unhandled_block);
+      unhandled_target.exception->addIncoming(target.exception, dispatch_block);
+      unhandled_target.selector->addIncoming(target.selector, dispatch_block);
+
+      /* Our exceptions are always thrown as an object_ptr, which is just a pointer. We can
+       * end the catch right away, since we've copied that out. */
+      ctx->builder->SetInsertPoint(catch_block);
+      auto const begin_catch_fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getPtrTy() }, false));
+      auto const begin_catch_fn(
+        ctx->module->getOrInsertFunction("__cxa_begin_catch", begin_catch_fn_type));
+      llvm::cast<llvm::Function>(begin_catch_fn.getCallee())->setDoesNotThrow();
+      auto const end_catch_fn_type(llvm::FunctionType::get(ctx->builder->getVoidTy(), false));
+      auto const end_catch_fn(
+        ctx->module->getOrInsertFunction("__cxa_end_catch", end_catch_fn_type));
+      llvm::cast<llvm::Function>(end_catch_fn.getCallee())->setDoesNotThrow();
+
+      auto const thrown(ctx->builder->CreateCall(begin_catch_fn, { target.exception }));
+      auto const exception(ctx->builder->CreateLoad(ctx->builder->getPtrTy(),
+                                                    thrown,
+                                                    catch_body.sym->to_string().c_str()));
+      ctx->builder->CreateCall(end_catch_fn, {});
+
+      auto old_locals(locals);
+      auto old_unboxed(unboxed_locals);
+      locals[catch_body.sym] = exception;
+      unboxed_locals.erase(catch_body.sym);
+
+      /* If there's a finally, it still needs to run when the catch throws. */
+      existing_blocks.clear();
+      for(auto &block : *current_fn)
+      {
+        existing_blocks.emplace_back(&block);
+      }
+      auto const catch_body_block(
+        llvm::BasicBlock::Create(*ctx->llvm_ctx, "catch_body", current_fn));
+      ctx->builder->CreateBr(catch_body_block);
+      ctx->builder->SetInsertPoint(catch_body_block);
+      if(has_finally)
+      {
+        try_targets.emplace_back(unhandled_target);
+      }
+
+      auto const caught(gen(catch_body.body, arity));
+      if(!is_return)
+      {
+        gen_ret(caught ? caught : nil);
+      }
+
+      if(has_finally)
+      {
+        try_targets.pop_back();
+        auto const catch_blocks(new_blocks_since(existing_blocks));
+        gen_invokes(catch_blocks, gen_landing_pad("catch_pad", outer_catches, unhandled_target));
+      }
+
+      locals = std::move(old_locals);
+      unboxed_locals = std::move(old_unboxed);
+    }
+    else
+    {
+      ctx->builder->CreateBr(unhandled_block);
+      unhandled_target.exception->addIncoming(target.exception, dispatch_block);
+      unhandled_target.selector->addIncoming(target.selector, dispatch_block);
+    }
+
+    current_tail = old_tail;
+    current_fn->insert(current_fn->end(), unhandled_block);
+    current_fn->insert(current_fn->end(), merge_block);
+    auto const result(llvm::cast<llvm::Value>(merge_block->begin()));
+
+    if(has_finally)
+    {
+      auto const finally_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "finally", current_fn));
+      ctx->builder->SetInsertPoint(unhandled_block);
+      ctx->builder->CreateBr(finally_block);
+      ctx->builder->SetInsertPoint(merge_block);
+      ctx->builder->CreateBr(finally_block);
+
+      ctx->builder->SetInsertPoint(finally_block);
+      auto const is_unwinding(ctx->builder->CreatePHI(ctx->builder->getInt1Ty(), 2, "unwinding"));
+      is_unwinding->addIncoming(ctx->builder->getFalse(), merge_block);
+      is_unwinding->addIncoming(ctx->builder->getTrue(), unhandled_block);
+      auto const exception(ctx->builder->CreatePHI(ctx->builder->getPtrTy(), 2, "exception"));
+      exception->addIncoming(llvm::PoisonValue::get(ctx->builder->getPtrTy()), merge_block);
+      exception->addIncoming(unhandled_target.exception, unhandled_block);
+      auto const selector(ctx->builder->CreatePHI(ctx->builder->getInt32Ty(), 2, "selector"));
+      selector->addIncoming(llvm::PoisonValue::get(ctx->builder->getInt32Ty()), merge_block);
+      selector->addIncoming(unhandled_target.selector, unhandled_block);
+
+      gen(expr.finally_body.unwrap(), arity);
+
+      auto const unwind_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "finally_unwind", current_fn));
+      auto const done_block(llvm::BasicBlock::Create(*ctx->llvm_ctx, "finally_done", current_fn));
+      ctx->builder->CreateCondBr(is_unwinding, unwind_block, done_block);
+
+      ctx->builder->SetInsertPoint(unwind_block);
+      gen_unwind(exception, selector);
+
+      ctx->builder->SetInsertPoint(done_block);
+    }
+    else
+    {
+      ctx->builder->SetInsertPoint(unhandled_block);
+      gen_unwind(unhandled_target.exception, unhandled_target.selector);
+      ctx->builder->SetInsertPoint(merge_block);
+    }
+
+    if(is_return)
+    {
+      return gen_ret(result);
+    }
+    return result;
   }
 
   llvm::Value *llvm_processor::gen(expr::case_<expression> const &expr,
@@ -1027,6 +1718,483 @@ namespace jank::codegen
     return nullptr;
   }
 
+  llvm::Value *llvm_processor::gen_ret(llvm::Value * const value) const
+  {
+    if(current_tail.exit)
+    {
+      current_tail.result->addIncoming(value, ctx->builder->GetInsertBlock());
+      return ctx->builder->CreateBr(current_tail.exit);
+    }
+
+    if(!profile_region.empty())
+    {
+      gen_profile_call("jank_profile_exit", profile_region);
+    }
+    return ctx->builder->CreateRet(value);
+  }
+
+  void llvm_processor::gen_profile_call(char const * const fn_name,
+                                        native_persistent_string const &region) const
+  {
+    auto const fn_type(
+      llvm::FunctionType::get(ctx->builder->getVoidTy(), { ctx->builder->getPtrTy() }, false));
+    auto const fn(ctx->module->getOrInsertFunction(fn_name, fn_type));
+    ctx->builder->CreateCall(fn, { gen_c_string(region) });
+  }
+
+  /* The clojure.core fns which can be compiled down to native instructions, when all of
+   * their args are unboxed. */
+  enum class unboxed_op : uint8_t
+  {
+    none,
+    add,
+    sub,
+    mul,
+    lt,
+    lte,
+    gt,
+    gte,
+    inc,
+    dec
+  };
+
+  static unboxed_op to_unboxed_op(expr::call<expression> const &expr)
+  {
+    auto const source(boost::get<expr::var_deref<expression>>(&expr.source_expr->data));
+    if(!source || source->var->n->name->name != "clojure.core")
+    {
+      return unboxed_op::none;
+    }
+
+    auto const &name(source->var->name->name);
+    switch(expr.arg_exprs.size())
+    {
+      case 1:
+        if(name == "inc")
+        {
+          return unboxed_op::inc;
+        }
+        else if(name == "dec")
+        {
+          return unboxed_op::dec;
+        }
+        return unboxed_op::none;
+      case 2:
+        if(name == "+")
+        {
+          return unboxed_op::add;
+        }
+        else if(name == "-")
+        {
+          return unboxed_op::sub;
+        }
+        else if(name == "*")
+        {
+          return unboxed_op::mul;
+        }
+        else if(name == "<")
+        {
+          return unboxed_op::lt;
+        }
+        else if(name == "<=")
+        {
+          return unboxed_op::lte;
+        }
+        else if(name == ">")
+        {
+          return unboxed_op::gt;
+        }
+        else if(name == ">=")
+        {
+          return unboxed_op::gte;
+        }
+        return unboxed_op::none;
+      default:
+        return unboxed_op::none;
+    }
+  }
+
+  /* Determines the native type an expression would have, if it were generated unboxed. This
+   * is i64 for integers, double for reals, and i1 for booleans. If the expression can't be
+   * proven to have one of those types, we return nullptr and it needs to be boxed. */
+  llvm::Type *llvm_processor::unboxed_type(expression_ptr const &expr) const
+  {
+    if(auto const literal = boost::get<expr::primitive_literal<expression>>(&expr->data))
+    {
+      auto const type(literal->data->type);
+      if(type == object_type::integer)
+      {
+        return ctx->builder->getInt64Ty();
+      }
+      else if(type == object_type::real)
+      {
+        return ctx->builder->getDoubleTy();
+      }
+      else if(type == object_type::boolean)
+      {
+        return ctx->builder->getInt1Ty();
+      }
+    }
+    else if(auto const local = boost::get<expr::local_reference>(&expr->data))
+    {
+      auto const found(unboxed_locals.find(local->binding.name));
+      return found == unboxed_locals.end() ? nullptr : found->second->getType();
+    }
+    else if(auto const call = boost::get<expr::call<expression>>(&expr->data))
+    {
+      return unboxed_type(*call);
+    }
+
+    return nullptr;
+  }
+
+  llvm::Type *llvm_processor::unboxed_type(expr::call<expression> const &expr) const
+  {
+    auto const op(to_unboxed_op(expr));
+    if(op == unboxed_op::none)
+    {
+      return nullptr;
+    }
+
+    /* Mixing integers and reals gives a real, just like the boxed math. */
+    llvm::Type *ret{};
+    for(auto const &arg_expr : expr.arg_exprs)
+    {
+      auto const type(unboxed_type(arg_expr));
+      if(type != ctx->builder->getInt64Ty() && type != ctx->builder->getDoubleTy())
+      {
+        return nullptr;
+      }
+      if(!ret || type->isDoubleTy())
+      {
+        ret = type;
+      }
+    }
+
+    switch(op)
+    {
+      case unboxed_op::lt:
+      case unboxed_op::lte:
+      case unboxed_op::gt:
+      case unboxed_op::gte:
+        return ctx->builder->getInt1Ty();
+      case unboxed_op::add:
+      case unboxed_op::sub:
+      case unboxed_op::mul:
+      case unboxed_op::inc:
+      case unboxed_op::dec:
+      case unboxed_op::none:
+        return ret;
+    }
+  }
+
+  /* A let binding is kept unboxed if its value can be and the analyzer found at least one
+   * usage which doesn't need a box. Otherwise, we'd just be boxing it again at every usage. */
+  llvm::Type *
+  llvm_processor::unboxed_binding_type(expr::let<expression> const &expr,
+                                       expr::let<expression>::pair_type const &pair) const
+  {
+    auto const local(expr.frame->find_local_or_capture(pair.first));
+    if(local.is_none() || !local.unwrap().binding.has_unboxed_usage)
+    {
+      return nullptr;
+    }
+
+    return unboxed_type(pair.second);
+  }
+
+  llvm::Value *llvm_processor::gen_unboxed(expression_ptr const &expr,
+                                           expr::function_arity<expression> const &arity)
+  {
+    if(auto const literal = boost::get<expr::primitive_literal<expression>>(&expr->data))
+    {
+      auto const type(literal->data->type);
+      if(type == object_type::integer)
+      {
+        return llvm::ConstantInt::getSigned(ctx->builder->getInt64Ty(),
+                                            expect_object<obj::integer>(literal->data)->data);
+      }
+      else if(type == object_type::real)
+      {
+        return llvm::ConstantFP::get(ctx->builder->getDoubleTy(),
+                                     expect_object<obj::real>(literal->data)->data);
+      }
+      else if(type == object_type::boolean)
+      {
+        return ctx->builder->getInt1(expect_object<obj::boolean>(literal->data)->data);
+      }
+    }
+    else if(auto const local = boost::get<expr::local_reference>(&expr->data))
+    {
+      auto const found(unboxed_locals.find(local->binding.name));
+      if(found != unboxed_locals.end())
+      {
+        return found->second;
+      }
+    }
+    else if(auto const call = boost::get<expr::call<expression>>(&expr->data))
+    {
+      return gen_unboxed(*call, arity);
+    }
+
+    throw std::runtime_error{ "ICE: unable to generate unboxed expression" };
+  }
+
+  llvm::Value *llvm_processor::gen_unboxed(expr::call<expression> const &expr,
+                                           expr::function_arity<expression> const &arity)
+  {
+    auto const op(to_unboxed_op(expr));
+    native_bool is_real{};
+    for(auto const &arg_expr : expr.arg_exprs)
+    {
+      is_real |= unboxed_type(arg_expr)->isDoubleTy();
+    }
+
+    llvm::SmallVector<llvm::Value *, 2> args;
+    for(auto const &arg_expr : expr.arg_exprs)
+    {
+      auto arg(gen_unboxed(arg_expr, arity));
+      if(is_real && arg->getType()->isIntegerTy())
+      {
+        arg = ctx->builder->CreateSIToFP(arg, ctx->builder->getDoubleTy());
+      }
+      args.emplace_back(arg);
+    }
+
+    auto const one(is_real ? llvm::ConstantFP::get(ctx->builder->getDoubleTy(), 1.0)
+                           : ctx->builder->getInt64(1));
+
+    switch(op)
+    {
+      case unboxed_op::add:
+        return is_real ? ctx->builder->CreateFAdd(args[0], args[1])
+                       : ctx->builder->CreateAdd(args[0], args[1]);
+      case unboxed_op::sub:
+        return is_real ? ctx->builder->CreateFSub(args[0], args[1])
+                       : ctx->builder->CreateSub(args[0], args[1]);
+      case unboxed_op::mul:
+        return is_real ? ctx->builder->CreateFMul(args[0], args[1])
+                       : ctx->builder->CreateMul(args[0], args[1]);
+      case unboxed_op::lt:
+        return is_real ? ctx->builder->CreateFCmpOLT(args[0], args[1])
+                       : ctx->builder->CreateICmpSLT(args[0], args[1]);
+      case unboxed_op::lte:
+        return is_real ? ctx->builder->CreateFCmpOLE(args[0], args[1])
+                       : ctx->builder->CreateICmpSLE(args[0], args[1]);
+      case unboxed_op::gt:
+        return is_real ? ctx->builder->CreateFCmpOGT(args[0], args[1])
+                       : ctx->builder->CreateICmpSGT(args[0], args[1]);
+      case unboxed_op::gte:
+        return is_real ? ctx->builder->CreateFCmpOGE(args[0], args[1])
+                       : ctx->builder->CreateICmpSGE(args[0], args[1]);
+      case unboxed_op::inc:
+        return is_real ? ctx->builder->CreateFAdd(args[0], one)
+                       : ctx->builder->CreateAdd(args[0], one);
+      case unboxed_op::dec:
+        return is_real ? ctx->builder->CreateFSub(args[0], one)
+                       : ctx->builder->CreateSub(args[0], one);
+      case unboxed_op::none:
+        break;
+    }
+
+    throw std::runtime_error{ "ICE: unable to generate unboxed call" };
+  }
+
+  /* Boxing is what happens when an unboxed value escapes. Values which folded down to
+   * constants reuse our literal globals, rather than allocating. */
+  llvm::Value *llvm_processor::gen_box(llvm::Value * const value) const
+  {
+    auto const type(value->getType());
+    if(type->isIntegerTy(64))
+    {
+      if(auto const constant = llvm::dyn_cast<llvm::ConstantInt>(value))
+      {
+        return gen_global(make_box(static_cast<native_integer>(constant->getSExtValue())));
+      }
+
+      auto const fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getInt64Ty() }, false));
+      auto const fn(ctx->module->getOrInsertFunction("jank_integer_create", fn_type));
+      return ctx->builder->CreateCall(fn, { value });
+    }
+    else if(type->isDoubleTy())
+    {
+      if(auto const constant = llvm::dyn_cast<llvm::ConstantFP>(value))
+      {
+        return gen_global(make_box(constant->getValueAPF().convertToDouble()));
+      }
+
+      auto const fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getDoubleTy() }, false));
+      auto const fn(ctx->module->getOrInsertFunction("jank_real_create", fn_type));
+      return ctx->builder->CreateCall(fn, { value });
+    }
+    else if(type->isIntegerTy(1))
+    {
+      return ctx->builder->CreateSelect(value,
+                                        gen_global(obj::boolean::true_const()),
+                                        gen_global(obj::boolean::false_const()));
+    }
+
+    return value;
+  }
+
+  /* All recurs for a loop are in tail position of its body, so we only need to follow the
+   * tails, keeping track of any let bindings along the way. Nested loops have their own
+   * recurs, so we stop there. Returns whether any binding was demoted. */
+  native_bool llvm_processor::demote_loop_bindings(expression_ptr const &expr,
+                                                   native_vector<llvm::Type *> &types)
+  {
+    if(auto const recur = boost::get<expr::recur<expression>>(&expr->data))
+    {
+      native_bool changed{};
+      for(size_t i{}; i < types.size() && i < recur->arg_exprs.size(); ++i)
+      {
+        if(types[i] && unboxed_type(recur->arg_exprs[i]) != types[i])
+        {
+          types[i] = nullptr;
+          changed = true;
+        }
+      }
+      return changed;
+    }
+    else if(auto const do_ = boost::get<expr::do_<expression>>(&expr->data))
+    {
+      return demote_loop_bindings(*do_, types);
+    }
+    else if(auto const let = boost::get<expr::let<expression>>(&expr->data))
+    {
+      if(let->is_loop)
+      {
+        return false;
+      }
+
+      auto old_unboxed(unboxed_locals);
+      for(auto const &pair : let->pairs)
+      {
+        if(auto const type = unboxed_binding_type(*let, pair))
+        {
+          unboxed_locals[pair.first] = llvm::PoisonValue::get(type);
+        }
+        else
+        {
+          unboxed_locals.erase(pair.first);
+        }
+      }
+      auto const changed(demote_loop_bindings(let->body, types));
+      unboxed_locals = std::move(old_unboxed);
+      return changed;
+    }
+    else if(auto const if_ = boost::get<expr::if_<expression>>(&expr->data))
+    {
+      auto changed(demote_loop_bindings(if_->then, types));
+      if(if_->else_.is_some())
+      {
+        changed |= demote_loop_bindings(if_->else_.unwrap(), types);
+      }
+      return changed;
+    }
+    else if(auto const case_ = boost::get<expr::case_<expression>>(&expr->data))
+    {
+      auto changed(demote_loop_bindings(case_->default_expr, types));
+      for(auto const &case_expr : case_->exprs)
+      {
+        changed |= demote_loop_bindings(case_expr, types);
+      }
+      return changed;
+    }
+
+    return false;
+  }
+
+  native_bool llvm_processor::demote_loop_bindings(expr::do_<expression> const &expr,
+                                                   native_vector<llvm::Type *> &types)
+  {
+    if(expr.values.empty())
+    {
+      return false;
+    }
+    return demote_loop_bindings(expr.values.back(), types);
+  }
+
+  /* Every jank exception is thrown as an object_ptr, so this is the C++ type info for
+   * native_box<object>, which the unwinder matches against. */
+  llvm::Constant *llvm_processor::gen_exception_type_info() const
+  {
+    return ctx->module->getOrInsertGlobal("_ZTIN4jank7runtime10native_boxINS0_6objectEEE",
+                                          ctx->builder->getPtrTy());
+  }
+
+  llvm::BasicBlock *llvm_processor::gen_landing_pad(native_persistent_string const &name,
+                                                    native_bool const catches,
+                                                    try_target const &target) const
+  {
+    llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
+    auto const current_fn(ctx->builder->GetInsertBlock()->getParent());
+    auto const block(llvm::BasicBlock::Create(*ctx->llvm_ctx, name.c_str(), current_fn));
+    ctx->builder->SetInsertPoint(block);
+
+    auto const pad_type(
+      llvm::StructType::get(*ctx->llvm_ctx, { ctx->builder->getPtrTy(), ctx->builder->getInt32Ty() }));
+    auto const pad(ctx->builder->CreateLandingPad(pad_type, 1));
+    pad->setCleanup(true);
+    if(catches)
+    {
+      pad->addClause(gen_exception_type_info());
+    }
+
+    target.exception->addIncoming(ctx->builder->CreateExtractValue(pad, 0), block);
+    target.selector->addIncoming(ctx->builder->CreateExtractValue(pad, 1), block);
+    ctx->builder->CreateBr(target.dispatch);
+
+    return block;
+  }
+
+  /* Calls within a try need to unwind to its landing pad, so they become invokes. Anything
+   * which was already turned into an invoke belongs to a nested try. */
+  void llvm_processor::gen_invokes(native_vector<llvm::BasicBlock *> const &blocks,
+                                   llvm::BasicBlock * const unwind) const
+  {
+    native_vector<llvm::CallInst *> calls;
+    for(auto const block : blocks)
+    {
+      for(auto &inst : *block)
+      {
+        auto const call(llvm::dyn_cast<llvm::CallInst>(&inst));
+        if(call && !call->doesNotThrow() && !llvm::isa<llvm::IntrinsicInst>(call))
+        {
+          calls.emplace_back(call);
+        }
+      }
+    }
+
+    for(auto const call : calls)
+    {
+      llvm::changeToInvokeAndSplitBasicBlock(call, unwind);
+    }
+  }
+
+  /* Continues unwinding an exception we didn't handle. If we're within another try in this
+   * function, it gets a chance to handle it. Otherwise, it leaves the function. */
+  void llvm_processor::gen_unwind(llvm::Value * const exception, llvm::Value * const selector) const
+  {
+    if(try_targets.empty())
+    {
+      auto const pad_type(
+        llvm::StructType::get(*ctx->llvm_ctx, { ctx->builder->getPtrTy(), ctx->builder->getInt32Ty() }));
+      llvm::Value *pad{ llvm::PoisonValue::get(pad_type) };
+      pad = ctx->builder->CreateInsertValue(pad, exception, 0);
+      pad = ctx->builder->CreateInsertValue(pad, selector, 1);
+      ctx->builder->CreateResume(pad);
+      return;
+    }
+
+    auto const &outer(try_targets.back());
+    outer.exception->addIncoming(exception, ctx->builder->GetInsertBlock());
+    outer.selector->addIncoming(selector, ctx->builder->GetInsertBlock());
+    ctx->builder->CreateBr(outer.dispatch);
+  }
+
   llvm::Value *llvm_processor::gen_var(obj::symbol_ptr const qualified_name) const
   {
     auto const found(ctx->var_globals.find(qualified_name));
@@ -1325,7 +2493,7 @@ namespace jank::codegen
                                   false));
         auto const set_meta_fn(ctx->module->getOrInsertFunction("jank_set_meta", set_meta_fn_type));
 
-        auto const meta(gen_global_from_read_string(s->meta.unwrap()));
+        auto const meta(gen_constant(s->meta.unwrap()));
         ctx->builder->CreateCall(set_meta_fn, { call, meta });
       }
 
@@ -1414,7 +2582,63 @@ namespace jank::codegen
     return ctx->builder->CreateLoad(ctx->builder->getPtrTy(), global);
   }
 
-  llvm::Value *llvm_processor::gen_global_from_read_string(object_ptr const o)
+  llvm::Value *llvm_processor::gen_constant(object_ptr const o)
+  {
+    return runtime::visit_object(
+      [&](auto const typed_o) -> llvm::Value * {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(std::same_as<T, runtime::obj::nil> || std::same_as<T, runtime::obj::boolean>
+                     || std::same_as<T, runtime::obj::integer>
+                     || std::same_as<T, runtime::obj::real> || std::same_as<T, runtime::obj::symbol>
+                     || std::same_as<T, runtime::obj::character>
+                     || std::same_as<T, runtime::obj::keyword>
+                     || std::same_as<T, runtime::obj::persistent_string>
+                     || std::same_as<T, runtime::obj::ratio>)
+        {
+          return gen_global(typed_o);
+        }
+        else if constexpr(std::same_as<T, runtime::obj::persistent_vector>
+                          || std::same_as<T, runtime::obj::persistent_list>
+                          || std::same_as<T, runtime::obj::persistent_hash_set>
+                          || std::same_as<T, runtime::obj::persistent_array_map>
+                          || std::same_as<T, runtime::obj::persistent_hash_map>
+                          /* Cons, etc. */
+                          || runtime::behavior::seqable<T>)
+        {
+          return gen_global_collection(typed_o);
+        }
+        else
+        {
+          throw std::runtime_error{ fmt::format("unimplemented constant codegen: {}\n",
+                                                typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
+  llvm::Value *llvm_processor::gen_constant_scratch(size_t const size) const
+  {
+    auto const size_value(ctx->builder->getInt64(size));
+    if(!ctx->constant_scratch)
+    {
+      llvm::IRBuilder<> entry_builder{ ctx->global_ctor_block, ctx->global_ctor_block->begin() };
+      ctx->constant_scratch
+        = entry_builder.CreateAlloca(ctx->builder->getPtrTy(), size_value, "constant_scratch");
+    }
+    else if(llvm::cast<llvm::ConstantInt>(ctx->constant_scratch->getArraySize())->getZExtValue()
+            < size)
+    {
+      ctx->constant_scratch->setOperand(0, size_value);
+    }
+    return ctx->constant_scratch;
+  }
+
+  /* Collection constants used to be printed to a string and read back in by the global ctor,
+   * which put the reader on the load path of every module. Instead, we build each one from
+   * its elements, which are themselves constants. This means nested constants are shared
+   * with anything else in the module which uses them. */
+  llvm::Value *llvm_processor::gen_global_collection(object_ptr const o)
   {
     auto const found(ctx->literal_globals.find(o));
     if(found != ctx->literal_globals.end())
@@ -1433,40 +2657,100 @@ namespace jank::codegen
       llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
       ctx->builder->SetInsertPoint(ctx->global_ctor_block);
 
-      auto const create_fn_type(
-        llvm::FunctionType::get(ctx->builder->getPtrTy(), { ctx->builder->getPtrTy() }, false));
-      auto const create_fn(ctx->module->getOrInsertFunction("jank_read_string", create_fn_type));
-
-      llvm::SmallVector<llvm::Value *, 1> const args{ gen_global(
-        make_box(runtime::to_code_string(o))) };
-      auto const call(ctx->builder->CreateCall(create_fn, args));
-      ctx->builder->CreateStore(call, global);
-
+      native_vector<llvm::Value *> items;
+      native_persistent_string create_fn_name;
+      size_t count{};
+      option<object_ptr> meta;
       runtime::visit_object(
         [&](auto const typed_o) {
           using T = typename decltype(typed_o)::value_type;
 
           if constexpr(behavior::metadatable<T>)
           {
-            if(typed_o->meta)
+            meta = typed_o->meta;
+          }
+
+          if constexpr(std::same_as<T, obj::persistent_array_map>
+                       || std::same_as<T, obj::persistent_hash_map>
+                       || std::same_as<T, obj::persistent_sorted_map>)
+          {
+            create_fn_name = "jank_map_create_from_array";
+            for(auto const &entry : typed_o->data)
             {
-              auto const set_meta_fn_type(
-                llvm::FunctionType::get(ctx->builder->getVoidTy(),
-                                        { ctx->builder->getPtrTy(), ctx->builder->getPtrTy() },
-                                        false));
-              auto const set_meta_fn(
-                ctx->module->getOrInsertFunction("jank_set_meta", set_meta_fn_type));
-
-              /* TODO: This shouldn't be its own global; we don't need to reference it later. */
-              auto const meta(gen_global_from_read_string(typed_o->meta.unwrap()));
-              auto const meta_name(fmt::format("{}_meta", name));
-              meta->setName(meta_name);
-              ctx->builder->CreateCall(set_meta_fn, { call, meta });
+              items.emplace_back(gen_constant(entry.first));
+              items.emplace_back(gen_constant(entry.second));
             }
+            count = items.size() / 2;
+          }
+          else if constexpr(std::same_as<T, obj::persistent_vector>)
+          {
+            create_fn_name = "jank_vector_create_from_array";
+            for(auto const &e : typed_o->data)
+            {
+              items.emplace_back(gen_constant(e));
+            }
+            count = items.size();
+          }
+          else if constexpr(std::same_as<T, obj::persistent_hash_set>
+                            || std::same_as<T, obj::persistent_sorted_set>)
+          {
+            create_fn_name = "jank_set_create_from_array";
+            for(auto const &e : typed_o->data)
+            {
+              items.emplace_back(gen_constant(e));
+            }
+            count = items.size();
+          }
+          else if constexpr(behavior::seqable<T>)
+          {
+            /* Any other sequence reads back in as a list. */
+            create_fn_name = "jank_list_create_from_array";
+            for(auto it(typed_o->fresh_seq()); it != nullptr; it = next_in_place(it))
+            {
+              items.emplace_back(gen_constant(it->first()));
+            }
+            count = items.size();
+          }
+          else
+          {
+            throw std::runtime_error{ fmt::format("unimplemented constant codegen: {}\n",
+                                                  typed_o->to_string()) };
           }
         },
         o);
 
+      llvm::Value *array{ llvm::ConstantPointerNull::get(ctx->builder->getPtrTy()) };
+      if(!items.empty())
+      {
+        array = gen_constant_scratch(items.size());
+        for(size_t i{}; i < items.size(); ++i)
+        {
+          ctx->builder->CreateStore(
+            items[i],
+            ctx->builder->CreateConstInBoundsGEP1_64(ctx->builder->getPtrTy(), array, i));
+        }
+      }
+
+      auto const create_fn_type(
+        llvm::FunctionType::get(ctx->builder->getPtrTy(),
+                                { ctx->builder->getInt64Ty(), ctx->builder->getPtrTy() },
+                                false));
+      auto const create_fn(
+        ctx->module->getOrInsertFunction(create_fn_name.c_str(), create_fn_type));
+      auto const call(
+        ctx->builder->CreateCall(create_fn, { ctx->builder->getInt64(count), array }, name));
+      ctx->builder->CreateStore(call, global);
+
+      if(meta.is_some())
+      {
+        auto const set_meta_fn_type(
+          llvm::FunctionType::get(ctx->builder->getVoidTy(),
+                                  { ctx->builder->getPtrTy(), ctx->builder->getPtrTy() },
+                                  false));
+        auto const set_meta_fn(ctx->module->getOrInsertFunction("jank_set_meta", set_meta_fn_type));
+        ctx->builder->CreateCall(set_meta_fn, { call, gen_constant(meta.unwrap()) });
+      }
+
       if(prev_block == ctx->global_ctor_block)
       {
         return call;
@@ -1590,7 +2874,7 @@ namespace jank::codegen
                                 false));
       auto const set_meta_fn(ctx->module->getOrInsertFunction("jank_set_meta", set_meta_fn_type));
 
-      auto const meta(gen_global_from_read_string(expr.meta));
+      auto const meta(gen_constant(expr.meta));
       ctx->builder->CreateCall(set_meta_fn, { fn_obj, meta });
     }
 
@@ -1618,12 +2902,7 @@ namespace jank::codegen
     {
       llvm::IRBuilder<>::InsertPointGuard const guard{ *ctx->builder };
       ctx->builder->SetInsertPoint(ctx->global_ctor_block);
-
-      auto const fn_type(
-        llvm::FunctionType::get(ctx->builder->getVoidTy(), { ctx->builder->getPtrTy() }, false));
-      auto const fn(ctx->module->getOrInsertFunction("jank_profile_enter", fn_type));
-      ctx->builder->CreateCall(fn,
-                               { gen_c_string(fmt::format("global ctor for {}", root_fn.name)) });
+      gen_profile_call("jank_profile_enter", fmt::format("global ctor for {}", root_fn.name));
     }
   }
 
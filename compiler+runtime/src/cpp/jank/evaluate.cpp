@@ -10,6 +10,7 @@
 #include <jank/runtime/behavior/callable.hpp>
 #include <jank/codegen/llvm_processor.hpp>
 #include <jank/jit/processor.hpp>
+#include <jank/jit/background_compiler.hpp>
 #include <jank/evaluate.hpp>
 #include <jank/profile/time.hpp>
 #include <jank/util/scope_exit.hpp>
@@ -253,6 +254,23 @@ namespace jank::evaluate
     return ret;
   }
 
+  /* Generates the IR for a fn definition here, but leaves its optimization and compilation
+   * to the background JIT. The var is pending until then. */
+  static void eval_in_background(expr::function<expression> const &expr, var_ptr const var)
+  {
+    auto const &module(
+      module::nest_module(expect_object<ns>(__rt_ctx->current_ns_var->deref())->to_string(),
+                          munge(expr.unique_name)));
+
+    auto const wrapped_expr(evaluate::wrap_expression(expr, "repl_fn", {}));
+    codegen::llvm_processor cg_prc{ wrapped_expr, module, codegen::compilation_target::eval };
+    cg_prc.gen_unoptimized().expect_ok();
+
+    __rt_ctx->background_jit->submit(std::move(cg_prc.ctx),
+                                     fmt::format("{}_0", munge(cg_prc.root_fn.unique_name)),
+                                     var);
+  }
+
   object_ptr eval(expr::def<expression> const &expr)
   {
     auto var(__rt_ctx->intern_var(expr.name).expect_ok());
@@ -267,7 +285,17 @@ namespace jank::evaluate
       return var;
     }
 
-    auto const evaluated_value(eval(expr.value.unwrap()));
+    auto const &value(expr.value.unwrap());
+    if(__rt_ctx->background_jit)
+    {
+      if(auto const fn = boost::get<expr::function<expression>>(&value->data))
+      {
+        eval_in_background(*fn, var);
+        return var;
+      }
+    }
+
+    auto const evaluated_value(eval(value));
     var->bind_root(evaluated_value);
 
     return var;
@@ -557,7 +585,7 @@ namespace jank::evaluate
     cg_prc.gen().expect_ok();
 
     {
-      profile::timer const timer{ fmt::format("ir jit compile {}", expr.name) };
+      profile::timer const timer{ [&] { return fmt::format("ir jit compile {}", expr.name); } };
       __rt_ctx->jit_prc.load_ir_module(std::move(cg_prc.ctx->module),
                                        std::move(cg_prc.ctx->llvm_ctx));
 
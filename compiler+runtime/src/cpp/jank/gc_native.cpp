@@ -0,0 +1,95 @@
+#include <gc/gc.h>
+
+#include <jank/gc_native.hpp>
+#include <jank/runtime/convert.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/util/gc_config.hpp>
+
+namespace jank::gc_native
+{
+  using namespace jank::runtime;
+
+  static object_ptr stats()
+  {
+    auto const stats(util::get_gc_stats());
+    auto const kw([](native_persistent_string_view const &name) {
+      return __rt_ctx->intern_keyword(name).expect_ok();
+    });
+    auto const ms([](uint64_t const ns) { return static_cast<native_real>(ns) / 1'000'000.0; });
+
+    return obj::persistent_hash_map::create_unique(
+      std::make_pair(kw("collections"), make_box(stats.collections)),
+      std::make_pair(kw("total-pause-ms"), make_box(ms(stats.total_pause_ns))),
+      std::make_pair(kw("max-pause-ms"), make_box(ms(stats.max_pause_ns))),
+      std::make_pair(kw("heap-bytes"), make_box(stats.heap_bytes)),
+      std::make_pair(kw("free-bytes"), make_box(stats.free_bytes)),
+      std::make_pair(kw("unmapped-bytes"), make_box(stats.unmapped_bytes)),
+      std::make_pair(kw("bytes-since-collection"), make_box(stats.bytes_since_collection)),
+      std::make_pair(kw("bytes-allocated"),
+                     make_box(stats.bytes_allocated + stats.bytes_since_collection)),
+      std::make_pair(kw("markers"), make_box(stats.markers)),
+      std::make_pair(kw("incremental"), make_box(stats.incremental)));
+  }
+
+  static object_ptr collect()
+  {
+    GC_gcollect();
+    return obj::nil::nil_const();
+  }
+
+  static object_ptr enable_incremental()
+  {
+    GC_enable_incremental();
+    return obj::nil::nil_const();
+  }
+
+  static object_ptr expand_heap(object_ptr const bytes)
+  {
+    return make_box(GC_expand_hp(static_cast<size_t>(to_int(bytes))) != 0);
+  }
+
+  static object_ptr set_max_heap(object_ptr const bytes)
+  {
+    GC_set_max_heap_size(static_cast<GC_word>(to_int(bytes)));
+    return obj::nil::nil_const();
+  }
+
+  static object_ptr set_free_space_divisor(object_ptr const divisor)
+  {
+    auto const d(to_int(divisor));
+    if(d <= 0)
+    {
+      throw std::runtime_error{ "the free space divisor must be positive" };
+    }
+    GC_set_free_space_divisor(static_cast<GC_word>(d));
+    return obj::nil::nil_const();
+  }
+}
+
+jank_object_ptr jank_load_jank_gc_native()
+{
+  using namespace jank;
+  using namespace jank::runtime;
+
+  auto const ns(__rt_ctx->intern_ns("jank.gc-native"));
+
+  auto const intern_fn([=](native_persistent_string const &name, auto const fn) {
+    ns->intern_var(name)->bind_root(
+      make_box<obj::native_function_wrapper>(convert_function(fn))
+        ->with_meta(obj::persistent_hash_map::create_unique(std::make_pair(
+          __rt_ctx->intern_keyword("name").expect_ok(),
+          make_box(obj::symbol{ __rt_ctx->current_ns()->to_string(), name }.to_string())))));
+  });
+  intern_fn("stats", &gc_native::stats);
+  intern_fn("collect", &gc_native::collect);
+  intern_fn("enable-incremental", &gc_native::enable_incremental);
+  intern_fn("expand-heap", &gc_native::expand_heap);
+  intern_fn("set-max-heap", &gc_native::set_max_heap);
+  intern_fn("set-free-space-divisor", &gc_native::set_free_space_divisor);
+
+  return erase(obj::nil::nil_const());
+}
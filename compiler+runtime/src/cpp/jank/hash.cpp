@@ -1,3 +1,7 @@
+#include <array>
+#include <bit>
+#include <cstring>
+
 #include <jank/hash.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core/seq.hpp>
@@ -125,16 +129,65 @@ namespace jank::hash
     }
   }
 
+  /* Strings are mixed two chars at a time, with the chars being sign extended. This matches
+   * what Clojure does with Java's UTF-16 chars, for ASCII. */
+  static uint32_t string_chunk(char const lo, char const hi)
+  {
+    return static_cast<uint32_t>(lo | (hi << 16));
+  }
+
   uint32_t string(native_persistent_string_view const &input)
   {
+    auto const data(input.data());
     auto const length(input.size());
     uint32_t h1{ seed };
+    size_t i{};
 
-    for(size_t i{ 1 }; i < length; i += 2)
+    /* Rather than reading two chars at a time, we read eight and build the four chunks from
+     * the word. This only works for ASCII, since other bytes are sign extended into the
+     * neighboring char, so we handle those words a chunk at a time. The chunks don't depend
+     * on each other, or on h1, so they can all be mixed before they're folded in. */
+    if constexpr(std::endian::native == std::endian::little)
     {
-      auto k1(static_cast<uint32_t>(input[i - 1] | (input[i] << 16)));
-      k1 = mix_k1(k1);
-      h1 = mix_h1(h1, k1);
+      static constexpr uint64_t high_bits{ 0x8080808080808080 };
+
+      for(; i + 8 <= length; i += 8)
+      {
+        uint64_t word{};
+        std::memcpy(&word, data + i, sizeof(word));
+
+        std::array<uint32_t, 4> k1s{};
+        if((word & high_bits) == 0) [[likely]]
+        {
+          for(size_t c{}; c < k1s.size(); ++c)
+          {
+            auto const lo((word >> (c * 16)) & 0xff);
+            auto const hi((word >> (c * 16 + 8)) & 0xff);
+            k1s[c] = static_cast<uint32_t>(lo | (hi << 16));
+          }
+        }
+        else
+        {
+          for(size_t c{}; c < k1s.size(); ++c)
+          {
+            k1s[c] = string_chunk(data[i + c * 2], data[i + c * 2 + 1]);
+          }
+        }
+
+        for(auto &k1 : k1s)
+        {
+          k1 = mix_k1(k1);
+        }
+        for(auto const k1 : k1s)
+        {
+          h1 = mix_h1(h1, k1);
+        }
+      }
+    }
+
+    for(; i + 1 < length; i += 2)
+    {
+      h1 = mix_h1(h1, mix_k1(string_chunk(data[i], data[i + 1])));
     }
 
     if((length & 1) == 1)
@@ -0,0 +1,323 @@
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/SmallVectorMemoryBuffer.h>
+#include <llvm/Target/TargetMachine.h>
+
+#include <fmt/format.h>
+
+#include <jank/native_persistent_string/fmt.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/codegen/llvm_processor.hpp>
+#include <jank/jit/background_compiler.hpp>
+#include <jank/jit/processor.hpp>
+#include <jank/util/gc_thread.hpp>
+#include <jank/profile/time.hpp>
+
+namespace jank::jit
+{
+  /* Target machines aren't thread-safe, but they're expensive enough to create that we
+   * keep one per worker. */
+  static string_result<llvm::TargetMachine *> thread_target_machine()
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    static thread_local std::unique_ptr<llvm::TargetMachine> target_machine;
+    if(target_machine)
+    {
+      return target_machine.get();
+    }
+
+    /* This matches what LLJIT uses for the host, so our objects can be linked with
+     * everything else it has compiled. */
+    auto builder{ llvm::orc::JITTargetMachineBuilder::detectHost() };
+    if(!builder)
+    {
+      return err(llvm::toString(builder.takeError()));
+    }
+    builder->setCodeGenOptLevel(llvm::CodeGenOptLevel::Default);
+
+    auto created{ builder->createTargetMachine() };
+    if(!created)
+    {
+      return err(llvm::toString(created.takeError()));
+    }
+    target_machine = std::move(created.get());
+    return target_machine.get();
+  }
+
+  background_compiler::background_compiler(processor const &jit_prc, size_t const thread_count)
+    : jit_prc{ jit_prc }
+  {
+    for(size_t i{}; i < thread_count; ++i)
+    {
+      threads.emplace_back([this] {
+        /* Our workers allocate GC objects, so they need to be registered with the GC. */
+        util::gc_thread_scope const gc_thread;
+        work();
+      });
+    }
+  }
+
+  background_compiler::~background_compiler()
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      stopping = true;
+    }
+    task_available.notify_all();
+
+    for(auto &thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  void background_compiler::submit(std::unique_ptr<codegen::reusable_context> ctx,
+                                   native_persistent_string const &fn_name,
+                                   runtime::var_ptr const var)
+  {
+    auto const t{ std::allocate_shared<task>(native_allocator<task>{}) };
+    t->ctor_name = ctx->ctor_name;
+    t->ctx = std::move(ctx);
+    t->fn_name = fn_name;
+    t->var = var;
+
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      /* The var becomes pending while we hold the lock, so anything which sees it pending
+       * will also find this task. */
+      t->generation = var->set_pending_root();
+      t->id = next_id++;
+      queue.emplace_back(t);
+      tasks.emplace_back(t);
+      latest[var.data] = t;
+    }
+    task_available.notify_one();
+  }
+
+  void background_compiler::finish(runtime::var const &var)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    auto const found{ latest.find(&var) };
+    if(found == latest.end())
+    {
+      return;
+    }
+
+    /* Finishing can drop the task from the map, so we hold onto it ourselves. */
+    auto const t{ found->second };
+    finish(lock, t);
+    if(t->current == task::state::failed)
+    {
+      t->reported = true;
+      retire(t);
+      throw std::runtime_error{ t->error.c_str() };
+    }
+  }
+
+  size_t background_compiler::checkpoint() const
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    return next_id;
+  }
+
+  string_result<void> background_compiler::join(size_t const since)
+  {
+    profile::timer const timer{ "background jit join" };
+    std::unique_lock<std::mutex> lock{ mutex };
+
+    native_vector<task_ptr> joining;
+    for(auto const &t : tasks)
+    {
+      if(since <= t->id)
+      {
+        joining.emplace_back(t);
+      }
+    }
+
+    util::string_builder sb;
+    for(auto const &t : joining)
+    {
+      finish(lock, t);
+      if(t->current == task::state::failed && !t->reported)
+      {
+        t->reported = true;
+        retire(t);
+        sb(t->error)("\n");
+      }
+    }
+
+    if(sb.size() == 0)
+    {
+      return ok();
+    }
+    return err(sb.release());
+  }
+
+  void background_compiler::finish(std::unique_lock<std::mutex> &lock, task_ptr const &t)
+  {
+    /* If another thread is already finishing this task, we just wait for it. */
+    task_compiled.wait(lock, [&] {
+      return t->current != task::state::compiling && t->current != task::state::finishing;
+    });
+    if(t->current != task::state::compiled)
+    {
+      return;
+    }
+
+    t->current = task::state::finishing;
+    auto const found{ latest.find(t->var.data) };
+    native_bool const superseded{ found == latest.end() || found->second != t };
+    lock.unlock();
+
+    /* There's no point in building a fn for a stale submission, since its generation will
+     * keep it from being bound anyway. */
+    if(!superseded)
+    {
+      if(t->error.empty())
+      {
+        auto const res{ construct(*t) };
+        if(res.is_ok())
+        {
+          t->var->bind_pending_root(res.expect_ok(), t->generation);
+        }
+        else
+        {
+          t->error = res.expect_err();
+        }
+      }
+
+      if(!t->error.empty())
+      {
+        t->error = fmt::format("failed to compile {}: {}", t->var->to_string(), t->error);
+        /* Anyone waiting on this var still needs to be woken up. */
+        t->var->bind_pending_root(make_box<runtime::var_unbound_root>(t->var), t->generation);
+      }
+    }
+
+    lock.lock();
+    if(superseded || t->error.empty())
+    {
+      t->current = task::state::finished;
+      retire(t);
+    }
+    else
+    {
+      t->current = task::state::failed;
+    }
+    task_compiled.notify_all();
+  }
+
+  void background_compiler::retire(task_ptr const &t)
+  {
+    std::erase(tasks, t);
+    auto const found{ latest.find(t->var.data) };
+    if(found != latest.end() && found->second == t)
+    {
+      latest.erase(found);
+    }
+  }
+
+  void background_compiler::work()
+  {
+    while(true)
+    {
+      task_ptr t;
+      {
+        std::unique_lock<std::mutex> lock{ mutex };
+        task_available.wait(lock, [this] { return stopping || !queue.empty(); });
+        if(queue.empty())
+        {
+          return;
+        }
+        t = std::move(queue.front());
+        queue.pop_front();
+      }
+
+      auto const res{ compile(*t) };
+      {
+        std::lock_guard<std::mutex> const lock{ mutex };
+        if(res.is_err())
+        {
+          t->error = res.expect_err();
+        }
+        t->current = task::state::compiled;
+      }
+      task_compiled.notify_all();
+    }
+  }
+
+  string_result<void> background_compiler::compile(task &t) const
+  {
+    auto &ctx{ *t.ctx };
+
+    /* Object files don't run global ctors, so we run ours manually once it's linked. */
+    if(auto const ctors{ ctx.module->getNamedGlobal("llvm.global_ctors") })
+    {
+      ctors->eraseFromParent();
+    }
+
+    ctx.optimize();
+
+    auto const target_machine{ thread_target_machine() };
+    if(target_machine.is_err())
+    {
+      return err(target_machine.expect_err());
+    }
+
+    llvm::SmallVector<char, 0> object;
+    {
+      profile::timer const timer{ [&] {
+        return fmt::format("background jit emit {}", ctx.module_name);
+      } };
+      llvm::raw_svector_ostream os{ object };
+      llvm::legacy::PassManager pass;
+      if(target_machine.expect_ok()->addPassesToEmitFile(pass,
+                                                         os,
+                                                         nullptr,
+                                                         llvm::CodeGenFileType::ObjectFile))
+      {
+        return err(fmt::format("unable to emit object file for {}", ctx.module_name));
+      }
+      pass.run(*ctx.module);
+    }
+
+    jit_prc.load_object(std::make_unique<llvm::SmallVectorMemoryBuffer>(
+      std::move(object),
+      ctx.module->getModuleIdentifier(),
+      /*RequiresNullTerminator*/ false));
+
+    /* Everything else we need is in the JIT now. */
+    t.ctx.reset();
+    return ok();
+  }
+
+  string_result<runtime::object_ptr> background_compiler::construct(task const &t) const
+  {
+    try
+    {
+      auto const ctor{ jit_prc.find_symbol<void (*)()>(t.ctor_name) };
+      if(ctor.is_err())
+      {
+        return err(ctor.expect_err());
+      }
+      ctor.expect_ok()();
+
+      auto const fn{ jit_prc.find_symbol<runtime::object *(*)()>(t.fn_name) };
+      if(fn.is_err())
+      {
+        return err(fn.expect_err());
+      }
+      return runtime::object_ptr{ fn.expect_ok()() };
+    }
+    catch(std::exception const &e)
+    {
+      return err(e.what());
+    }
+    catch(runtime::object_ptr const o)
+    {
+      return err(runtime::to_code_string(o));
+    }
+  }
+}
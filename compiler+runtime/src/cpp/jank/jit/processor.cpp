@@ -136,6 +136,7 @@ namespace jank::jit
   void processor::eval_string(native_persistent_string const &s) const
   {
     profile::timer const timer{ "jit eval_string" };
+    std::lock_guard<std::recursive_mutex> const lock{ mutex };
     //fmt::println("// eval_string:\n{}\n", s);
     auto err(interpreter->ParseAndExecute({ s.data(), s.size() }));
     llvm::logAllUnhandledErrors(std::move(err), llvm::errs(), "error: ");
@@ -143,24 +144,31 @@ namespace jank::jit
 
   void processor::load_object(native_persistent_string_view const &path) const
   {
-    auto &ee{ interpreter->getExecutionEngine().get() };
     auto file{ llvm::MemoryBuffer::getFile(path) };
     if(!file)
     {
       throw std::runtime_error{ fmt::format("failed to load object file: {}", path) };
     }
+    load_object(std::move(file.get()));
+  }
+
+  void processor::load_object(std::unique_ptr<llvm::MemoryBuffer> buffer) const
+  {
+    std::lock_guard<std::recursive_mutex> const lock{ mutex };
+    auto &ee{ interpreter->getExecutionEngine().get() };
     /* XXX: Object files won't be able to use global ctors until jank is on the ORC
      * runtime, which likely won't happen until clang::Interpreter is on the ORC runtime. */
     /* TODO: Return result on failure. */
-    llvm::cantFail(ee.addObjectFile(std::move(file.get())));
+    llvm::cantFail(ee.addObjectFile(std::move(buffer)));
   }
 
   void processor::load_ir_module(std::unique_ptr<llvm::Module> m,
                                  std::unique_ptr<llvm::LLVMContext> llvm_ctx) const
   {
-    profile::timer const timer{ fmt::format("jit ir module {}", m->getName()) };
+    profile::timer const timer{ [&] { return fmt::format("jit ir module {}", m->getName()); } };
     //m->print(llvm::outs(), nullptr);
 
+    std::lock_guard<std::recursive_mutex> const lock{ mutex };
     auto &ee(interpreter->getExecutionEngine().get());
     llvm::cantFail(
       ee.addIRModule(llvm::orc::ThreadSafeModule{ std::move(m), std::move(llvm_ctx) }));
@@ -188,6 +196,7 @@ namespace jank::jit
 
   string_result<void> processor::remove_symbol(native_persistent_string const &name) const
   {
+    std::lock_guard<std::recursive_mutex> const lock{ mutex };
     auto &ee{ interpreter->getExecutionEngine().get() };
     llvm::orc::SymbolNameSet to_remove{};
     to_remove.insert(ee.mangleAndIntern(name.c_str()));
@@ -252,6 +261,7 @@ namespace jank::jit
 
   void processor::load_dynamic_library(native_persistent_string const &path) const
   {
+    std::lock_guard<std::recursive_mutex> const lock{ mutex };
     llvm::cantFail(interpreter->LoadDynamicLibrary(path.data()));
   }
 }
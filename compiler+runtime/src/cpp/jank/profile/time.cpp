@@ -1,17 +1,47 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <jank/native_persistent_string/fmt.hpp>
 #include <jank/profile/time.hpp>
+#include <jank/util/escape.hpp>
 
 namespace jank::profile
 {
-  static constexpr native_persistent_string_view tag{ "jank::profile" };
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-  static native_bool enabled{};
+  namespace detail
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    std::atomic_bool enabled{};
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
   static std::ofstream output;
+  /* The binary trace is what's written as we go. When the Chrome format is requested, it's
+   * written next to the final output and converted at shutdown. */
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static native_transient_string trace_file;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static native_transient_string chrome_file;
+  /* Each thread buffers its own events, but they all share the output. */
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::mutex output_mutex;
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::shared_mutex labels_mutex;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static native_unordered_map<native_persistent_string, label_id> labels;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static native_unordered_map<char const *, label_id> static_labels;
 
   static auto now()
   {
@@ -19,67 +49,508 @@ namespace jank::profile
     return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
   }
 
+  struct thread_buffer;
+
+  /* Some threads, like our JIT workers, outlive the profiling, so their buffers are
+   * tracked in order to be flushed at shutdown. */
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::mutex buffers_mutex;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::vector<thread_buffer *> buffers;
+
+  struct thread_buffer
+  {
+    static constexpr size_t capacity{ 4096 };
+
+    thread_buffer()
+    {
+      /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+      static std::atomic<uint16_t> next_thread{};
+      thread = next_thread++;
+      records.reserve(capacity);
+
+      std::lock_guard<std::mutex> const lock{ buffers_mutex };
+      buffers.push_back(this);
+    }
+
+    ~thread_buffer()
+    {
+      std::lock_guard<std::mutex> const lock{ buffers_mutex };
+      std::erase(buffers, this);
+      flush();
+    }
+
+    void push(record_kind const kind, label_id const label)
+    {
+      /* This is only ever contended during shutdown. */
+      std::lock_guard<std::mutex> const lock{ mutex };
+      records.push_back({ static_cast<uint64_t>(now()), label, thread, kind });
+      if(records.size() == capacity)
+      {
+        write();
+      }
+    }
+
+    void flush()
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      write();
+    }
+
+    std::mutex mutex;
+    std::vector<record> records;
+    uint16_t thread{};
+
+  private:
+    void write()
+    {
+      if(records.empty())
+      {
+        return;
+      }
+
+      std::lock_guard<std::mutex> const lock{ output_mutex };
+      output.write(reinterpret_cast<char const *>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(record)));
+      records.clear();
+    }
+  };
+
+  static thread_buffer &current_buffer()
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    static thread_local thread_buffer buffer;
+    return buffer;
+  }
+
   void configure(util::cli::options const &opts)
   {
-    enabled = opts.profiler_enabled;
+    if(!opts.profiler_enabled)
+    {
+      return;
+    }
+
+    trace_file = opts.profiler_file;
+    if(opts.profiler_format == "chrome")
+    {
+      chrome_file = opts.profiler_file;
+      trace_file += ".bin";
+    }
+
+    output.open(trace_file.data(), std::ios::binary | std::ios::trunc);
+    if(!output.is_open())
+    {
+      fmt::println(stderr,
+                   "Unable to open profile file: {}\nProfiling is now disabled.",
+                   trace_file);
+      return;
+    }
+
+    output.write(trace_magic.data(), static_cast<std::streamsize>(trace_magic.size()));
+    output.write(reinterpret_cast<char const *>(&trace_version), sizeof(trace_version));
+    detail::enabled.store(true, std::memory_order_relaxed);
+  }
+
+  /* Must be called with the labels lock held exclusively. */
+  static label_id insert_label(native_persistent_string_view const &label)
+  {
+    label_id const id(labels.size() + 1);
+    labels.emplace(label, id);
+
+    std::lock_guard<std::mutex> const lock{ output_mutex };
+    record const r{ label.size(), id, 0, record_kind::label };
+    output.write(reinterpret_cast<char const *>(&r), sizeof(r));
+    output.write(label.data(), static_cast<std::streamsize>(label.size()));
+    return id;
+  }
+
+  label_id intern(native_persistent_string_view const &label)
+  {
+    {
+      std::shared_lock<std::shared_mutex> const lock{ labels_mutex };
+      auto const found(labels.find(label));
+      if(found != labels.end())
+      {
+        return found->second;
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> const lock{ labels_mutex };
+    auto const found(labels.find(label));
+    if(found != labels.end())
+    {
+      return found->second;
+    }
+    return insert_label(label);
+  }
 
-    if(enabled)
+  label_id intern_static(char const * const label)
+  {
     {
-      output.open(opts.profiler_file.data());
-      if(!output.is_open())
+      std::shared_lock<std::shared_mutex> const lock{ labels_mutex };
+      auto const found(static_labels.find(label));
+      if(found != static_labels.end())
       {
-        enabled = false;
-        fmt::println(stderr,
-                     "Unable to open profile file: {}\nProfiling is now disabled.",
-                     opts.profiler_file);
+        return found->second;
       }
     }
+
+    auto const id(intern(label));
+    std::unique_lock<std::shared_mutex> const lock{ labels_mutex };
+    static_labels.emplace(label, id);
+    return id;
   }
 
-  native_bool is_enabled()
+  void enter(label_id const label) noexcept
   {
-    return enabled;
+    current_buffer().push(record_kind::enter, label);
+  }
+
+  void exit(label_id const label) noexcept
+  {
+    current_buffer().push(record_kind::exit, label);
+  }
+
+  void report(label_id const label) noexcept
+  {
+    current_buffer().push(record_kind::report, label);
   }
 
   void enter(native_persistent_string_view const &region)
   {
-    if(enabled)
+    if(is_enabled())
     {
-      fmt::println(output, "{} {} enter {}", tag, now(), region);
+      enter(intern(region));
     }
   }
 
   void exit(native_persistent_string_view const &region)
   {
-    if(enabled)
+    if(is_enabled())
     {
-      fmt::println(output, "{} {} exit {}", tag, now(), region);
+      exit(intern(region));
     }
   }
 
   void report(native_persistent_string_view const &boundary)
   {
-    if(enabled)
+    if(is_enabled())
     {
-      fmt::println(output, "{} {} report {}", tag, now(), boundary);
+      report(intern(boundary));
     }
   }
 
-  timer::timer(native_persistent_string_view const &region)
-    : region{ region }
+  void flush()
   {
-    enter(region);
+    if(is_enabled())
+    {
+      current_buffer().flush();
+    }
   }
 
-  timer::~timer()
-  try
+  void shutdown()
   {
-    exit(region);
+    if(!is_enabled())
+    {
+      return;
+    }
+    detail::enabled.store(false, std::memory_order_relaxed);
+
+    {
+      std::lock_guard<std::mutex> const lock{ buffers_mutex };
+      for(auto const buffer : buffers)
+      {
+        buffer->flush();
+      }
+    }
+    output.close();
+
+    std::ifstream trace{ trace_file.data(), std::ios::binary };
+    auto const summary(write_summary(trace, std::cerr));
+    if(summary.is_err())
+    {
+      fmt::println(stderr, "Unable to read profile file {}: {}", trace_file, summary.expect_err());
+      return;
+    }
+
+    if(chrome_file.empty())
+    {
+      return;
+    }
+
+    trace.clear();
+    trace.seekg(0);
+    std::ofstream chrome{ chrome_file.data(), std::ios::trunc };
+    auto const converted(write_chrome_trace(trace, chrome));
+    if(converted.is_err())
+    {
+      fmt::println(stderr,
+                   "Unable to convert profile file {}: {}",
+                   trace_file,
+                   converted.expect_err());
+      return;
+    }
+    trace.close();
+    std::remove(trace_file.data());
+  }
+
+  /* A region, from enter to exit, on a single thread. */
+  struct span
+  {
+    label_id label{};
+    uint16_t thread{};
+    uint64_t start{};
+    uint64_t end{};
+    /* Time spent in the spans directly within this one. */
+    uint64_t nested{};
+    /* When a region recurs, only the outermost span counts toward its inclusive time. */
+    native_bool recursive{};
+  };
+
+  struct parsed_trace
+  {
+    native_unordered_map<label_id, native_persistent_string> labels;
+    native_vector<span> spans;
+    native_vector<record> reports;
+    uint64_t start{ std::numeric_limits<uint64_t>::max() };
+  };
+
+  static void close_span(native_vector<span> &stack, uint64_t const time, parsed_trace &trace)
+  {
+    auto s(stack.back());
+    stack.pop_back();
+    s.end = std::max(s.start, time);
+    if(!stack.empty())
+    {
+      stack.back().nested += s.end - s.start;
+    }
+    trace.spans.push_back(s);
+  }
+
+  static string_result<parsed_trace> parse_trace(std::istream &in)
+  {
+    native_transient_string magic(trace_magic.size(), '\0');
+    uint32_t version{};
+    in.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    if(!in || magic != trace_magic)
+    {
+      return err("not a jank profile trace");
+    }
+    if(version != trace_version)
+    {
+      return err(fmt::format("unsupported trace version {}", version));
+    }
+
+    parsed_trace ret;
+    /* Events from different threads are interleaved, a buffer at a time, so each thread
+     * keeps its own stack of open spans. */
+    native_unordered_map<uint16_t, native_vector<span>> stacks;
+    uint64_t end{};
+    record r;
+    while(in.read(reinterpret_cast<char *>(&r), sizeof(r)))
+    {
+      if(r.kind == record_kind::label)
+      {
+        native_transient_string label(r.time, '\0');
+        if(!in.read(label.data(), static_cast<std::streamsize>(r.time)))
+        {
+          return err("truncated label");
+        }
+        ret.labels.emplace(r.label, label);
+        continue;
+      }
+
+      ret.start = std::min(ret.start, r.time);
+      end = std::max(end, r.time);
+
+      auto &stack(stacks[r.thread]);
+      switch(r.kind)
+      {
+        case record_kind::enter:
+          {
+            auto const recursive(std::ranges::any_of(stack, [&](span const &s) {
+              return s.label == r.label;
+            }));
+            stack.push_back({ r.label, r.thread, r.time, r.time, 0, recursive });
+            break;
+          }
+        case record_kind::exit:
+          {
+            /* When an exception unwinds through generated code, its regions are never
+             * exited. So we close everything within the span which is exiting. An exit
+             * with no matching enter is dropped. */
+            auto const found(
+              std::ranges::find(stack.rbegin(), stack.rend(), r.label, &span::label));
+            if(found == stack.rend())
+            {
+              break;
+            }
+            auto const depth(std::distance(found, stack.rend()) - 1);
+            while(static_cast<std::ptrdiff_t>(stack.size()) > depth)
+            {
+              close_span(stack, r.time, ret);
+            }
+            break;
+          }
+        case record_kind::report:
+          ret.reports.push_back(r);
+          break;
+        case record_kind::label:
+          break;
+      }
+    }
+
+    if(!in.eof())
+    {
+      return err("unable to read trace");
+    }
+
+    /* Anything still open, such as main itself, ends with the trace. */
+    for(auto &stack : stacks)
+    {
+      while(!stack.second.empty())
+      {
+        close_span(stack.second, end, ret);
+      }
+    }
+
+    return ret;
+  }
+
+  static native_persistent_string_view
+  label_name(parsed_trace const &trace, label_id const label)
+  {
+    auto const found(trace.labels.find(label));
+    if(found == trace.labels.end())
+    {
+      return "unknown";
+    }
+    return found->second;
+  }
+
+  string_result<void> write_chrome_trace(std::istream &trace, std::ostream &out)
+  {
+    auto const parsed(parse_trace(trace));
+    if(parsed.is_err())
+    {
+      return err(parsed.expect_err());
+    }
+    auto const &t(parsed.expect_ok());
+
+    /* Chrome wants microseconds. We keep the nanoseconds as fractions. */
+    auto const micros([&](uint64_t const time) {
+      return static_cast<double>(time - t.start) / 1000.0;
+    });
+
+    fmt::print(out, "{{\"traceEvents\":[");
+    native_bool first{ true };
+    auto const separate([&] {
+      if(!first)
+      {
+        out << ",";
+      }
+      out << "\n";
+      first = false;
+    });
+
+    for(auto const &s : t.spans)
+    {
+      separate();
+      fmt::print(out,
+                 R"({{"name":{},"ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{}}})",
+                 util::escaped_quoted_view(label_name(t, s.label)),
+                 micros(s.start),
+                 static_cast<double>(s.end - s.start) / 1000.0,
+                 s.thread);
+    }
+    for(auto const &r : t.reports)
+    {
+      separate();
+      fmt::print(out,
+                 R"({{"name":{},"ph":"i","s":"t","ts":{:.3f},"pid":1,"tid":{}}})",
+                 util::escaped_quoted_view(label_name(t, r.label)),
+                 micros(r.time),
+                 r.thread);
+    }
+    fmt::print(out, "\n],\"displayTimeUnit\":\"ns\"}}\n");
+
+    if(!out)
+    {
+      return err("unable to write trace");
+    }
+    return ok();
   }
-  catch(...)
+
+  string_result<void> write_summary(std::istream &trace, std::ostream &out)
   {
-    /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg): I need to log without exceptions. */
-    std::printf("Exception caught while destructing timer");
+    auto const parsed(parse_trace(trace));
+    if(parsed.is_err())
+    {
+      return err(parsed.expect_err());
+    }
+    auto const &t(parsed.expect_ok());
+
+    struct region
+    {
+      label_id label{};
+      size_t count{};
+      uint64_t inclusive{};
+      uint64_t exclusive{};
+    };
+
+    native_unordered_map<label_id, region> regions;
+    for(auto const &s : t.spans)
+    {
+      auto &r(regions[s.label]);
+      r.label = s.label;
+      ++r.count;
+      if(!s.recursive)
+      {
+        r.inclusive += s.end - s.start;
+      }
+      r.exclusive += s.end - s.start - std::min(s.nested, s.end - s.start);
+    }
+
+    native_vector<region> sorted;
+    sorted.reserve(regions.size());
+    for(auto const &r : regions)
+    {
+      sorted.push_back(r.second);
+    }
+    std::ranges::sort(sorted, [](region const &l, region const &r) {
+      return l.exclusive > r.exclusive;
+    });
+
+    /* Generated code adds a region per fn, so this can get long. */
+    static constexpr size_t max_rows{ 50 };
+    auto const millis([](uint64_t const time) { return static_cast<double>(time) / 1000000.0; });
+    fmt::println(out,
+                 "{:>14} {:>14} {:>10}  {}",
+                 "inclusive ms",
+                 "exclusive ms",
+                 "count",
+                 "region");
+    for(size_t i{}; i < std::min(sorted.size(), max_rows); ++i)
+    {
+      auto const &r(sorted[i]);
+      fmt::println(out,
+                   "{:>14.3f} {:>14.3f} {:>10}  {}",
+                   millis(r.inclusive),
+                   millis(r.exclusive),
+                   r.count,
+                   label_name(t, r.label));
+    }
+    if(sorted.size() > max_rows)
+    {
+      fmt::println(out, "... and {} more regions", sorted.size() - max_rows);
+    }
+
+    if(!out)
+    {
+      return err("unable to write summary");
+    }
+    return ok();
   }
 
   void timer::report(native_persistent_string_view const &boundary) const
@@ -3,6 +3,7 @@
 #include <fmt/format.h>
 
 #include <jank/read/lex.hpp>
+#include <jank/read/scan.hpp>
 #include <jank/error/lex.hpp>
 #include <jank/runtime/object.hpp>
 #include <jank/runtime/context.hpp>
@@ -275,10 +276,22 @@ namespace jank::read::lex
 
   movable_position &movable_position::operator+=(size_t const count)
   {
-    for(size_t i{}; i < count; ++i)
+    assert(offset + count <= proc->file.size());
+
+    /* Rather than stepping a byte at a time, we count the newlines we're skipping. The
+     * column is then relative to the last one. */
+    auto const skipped(proc->file.substr(offset, count));
+    if(auto const newlines(scan::count_newlines(skipped)); newlines != 0)
+    {
+      line += newlines;
+      col = count - skipped.rfind('\n');
+    }
+    else
     {
-      ++(*this);
+      col += count;
     }
+
+    offset += count;
     return *this;
   }
 
@@ -295,10 +308,7 @@ namespace jank::read::lex
   movable_position movable_position::operator+(size_t const count) const
   {
     movable_position ret{ *this };
-    for(size_t i{}; i < count; ++i)
-    {
-      ++ret;
-    }
+    ret += count;
     return ret;
   }
 
@@ -451,21 +461,12 @@ namespace jank::read::lex
   result<token, error_ptr> processor::next()
   {
     /* Skip whitespace. */
-    native_bool found_space{};
-    while(true)
+    auto const space_end(scan::skip_whitespace(file, pos.offset));
+    native_bool const found_space{ space_end != pos.offset };
+    pos += space_end - pos.offset;
+    if(pos.offset >= file.size())
     {
-      if(pos.offset >= file.size())
-      {
-        return ok(token{ pos, token_kind::eof });
-      }
-
-      if(auto const c(file[pos.offset]); std::isspace(c) == 0 && c != ',')
-      {
-        break;
-      }
-
-      found_space = true;
-      ++pos;
+      return ok(token{ pos, token_kind::eof });
     }
 
     /* Whether or not we've found the r in radix-specific integers such as 2r01010. */
@@ -935,6 +936,8 @@ namespace jank::read::lex
           }
           while(true)
           {
+            /* Runs of plain ASCII are skipped in bulk. Anything else is decoded here. */
+            pos += scan::skip_symbol(file, pos.offset + 1) - pos.offset - 1;
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -996,6 +999,7 @@ namespace jank::read::lex
 
           while(true)
           {
+            pos += scan::skip_symbol(file, pos.offset + 1) - pos.offset - 1;
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -1038,6 +1042,12 @@ namespace jank::read::lex
           native_bool escaped{}, contains_escape{};
           while(true)
           {
+            /* Most of a string needs no attention, so we skip right to the next quote,
+             * escape, or non-ASCII character. */
+            if(!escaped)
+            {
+              pos += scan::skip_string(file, pos.offset + 1) - pos.offset - 1;
+            }
             auto const oc(peek());
             if(oc.is_err())
             {
@@ -1237,6 +1247,7 @@ namespace jank::read::lex
           pos += oc.expect_ok().len;
           while(pos <= file.size())
           {
+            pos += scan::skip_symbol(file, pos.offset) - pos.offset;
             auto const result(convert_to_codepoint(file.substr(pos), pos));
             if(result.is_err())
             {
@@ -1300,7 +1300,7 @@ namespace jank::read::parse
   {
     auto const token(token_current->expect_ok());
     ++token_current;
-    return object_source_info{ make_box<obj::integer>(boost::get<native_integer>(token.data)),
+    return object_source_info{ make_box(boost::get<native_integer>(token.data)),
                                token,
                                token };
   }
@@ -0,0 +1,258 @@
+#include <bit>
+
+#if defined(__x86_64__)
+  #include <immintrin.h>
+#endif
+
+#include <jank/read/scan.hpp>
+
+namespace jank::read::scan
+{
+  static constexpr native_bool in_range(char const c, char const lo, char const hi)
+  {
+    return static_cast<unsigned char>(c - lo) <= static_cast<unsigned char>(hi - lo);
+  }
+
+  static constexpr native_bool is_whitespace(char const c)
+  {
+    return c == ' ' || c == ',' || in_range(c, '\t', '\r');
+  }
+
+  static constexpr native_bool is_symbol(char const c)
+  {
+    return in_range(c, '!', '}') && c != '"' && c != '(' && c != ')' && c != ','
+      && c != ';' && !in_range(c, '[', '^') && c != '`' && c != '{' && c != '}';
+  }
+
+  static constexpr native_bool is_string(char const c)
+  {
+    return in_range(c, '\x01', '\x7f') && c != '"' && c != '\\';
+  }
+
+  /* Each classifier returns a bit per byte of a block, set when that byte is in the class.
+   * Runs are then found by counting the trailing set bits. The remainder, which doesn't
+   * fill a block, is handled one byte at a time. A width of 0 means there's no vector
+   * support at all. */
+  using classifier = uint32_t (*)(char const *);
+
+  template <size_t Width, classifier Classify, native_bool (*Scalar)(char)>
+  static size_t skip(char const * const data, size_t i, size_t const size)
+  {
+    if constexpr(Width != 0)
+    {
+      constexpr uint32_t all{ Width == 32 ? ~uint32_t{} : (uint32_t{ 1 } << Width) - 1 };
+      for(; i + Width <= size; i += Width)
+      {
+        auto const mask(Classify(data + i));
+        if(mask != all)
+        {
+          return i + static_cast<size_t>(std::countr_one(mask));
+        }
+      }
+    }
+    for(; i < size && Scalar(data[i]); ++i)
+    {
+    }
+    return i;
+  }
+
+  template <size_t Width, classifier Classify>
+  static size_t count(char const * const data, size_t const size)
+  {
+    size_t ret{};
+    size_t i{};
+    if constexpr(Width != 0)
+    {
+      for(; i + Width <= size; i += Width)
+      {
+        ret += static_cast<size_t>(std::popcount(Classify(data + i)));
+      }
+    }
+    for(; i < size; ++i)
+    {
+      ret += data[i] == '\n';
+    }
+    return ret;
+  }
+
+#if defined(__x86_64__)
+  /* SSE2 is part of x86_64, so this is our baseline. */
+  namespace sse2
+  {
+    static constexpr size_t width{ 16 };
+
+    static __m128i load(char const * const data)
+    {
+      return _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+    }
+
+    static __m128i eq(__m128i const v, char const c)
+    {
+      return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+    }
+
+    /* There are no unsigned byte comparisons, but an unsigned min does the same job. */
+    static __m128i in_range(__m128i const v, char const lo, char const hi)
+    {
+      auto const shifted(_mm_sub_epi8(v, _mm_set1_epi8(lo)));
+      return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(static_cast<char>(hi - lo))),
+                            shifted);
+    }
+
+    static uint32_t mask(__m128i const v)
+    {
+      return static_cast<uint32_t>(_mm_movemask_epi8(v));
+    }
+
+    static uint32_t whitespace(char const * const data)
+    {
+      auto const v(load(data));
+      return mask(_mm_or_si128(_mm_or_si128(eq(v, ' '), eq(v, ',')), in_range(v, '\t', '\r')));
+    }
+
+    static uint32_t symbol(char const * const data)
+    {
+      auto const v(load(data));
+      auto special(_mm_or_si128(eq(v, '"'), eq(v, '(')));
+      special = _mm_or_si128(special, _mm_or_si128(eq(v, ')'), eq(v, ',')));
+      special = _mm_or_si128(special, _mm_or_si128(eq(v, ';'), in_range(v, '[', '^')));
+      special = _mm_or_si128(special, _mm_or_si128(eq(v, '`'), eq(v, '{')));
+      special = _mm_or_si128(special, eq(v, '}'));
+      return mask(_mm_andnot_si128(special, in_range(v, '!', '}')));
+    }
+
+    static uint32_t string(char const * const data)
+    {
+      auto const v(load(data));
+      auto const special(_mm_or_si128(eq(v, '"'), eq(v, '\\')));
+      return mask(_mm_andnot_si128(special, in_range(v, '\x01', '\x7f')));
+    }
+
+    static uint32_t newline(char const * const data)
+    {
+      return mask(eq(load(data), '\n'));
+    }
+  }
+
+  /* The same as above, twice as wide. We don't build with AVX2 enabled, so these are
+   * compiled for it specifically and only used when the CPU has it. */
+  namespace avx2
+  {
+    static constexpr size_t width{ 32 };
+
+    [[gnu::target("avx2")]] static __m256i load(char const * const data)
+    {
+      return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data));
+    }
+
+    [[gnu::target("avx2")]] static __m256i eq(__m256i const v, char const c)
+    {
+      return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+    }
+
+    [[gnu::target("avx2")]] static __m256i in_range(__m256i const v, char const lo, char const hi)
+    {
+      auto const shifted(_mm256_sub_epi8(v, _mm256_set1_epi8(lo)));
+      return _mm256_cmpeq_epi8(
+        _mm256_min_epu8(shifted, _mm256_set1_epi8(static_cast<char>(hi - lo))),
+        shifted);
+    }
+
+    [[gnu::target("avx2")]] static uint32_t mask(__m256i const v)
+    {
+      return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+    }
+
+    [[gnu::target("avx2")]] static uint32_t whitespace(char const * const data)
+    {
+      auto const v(load(data));
+      return mask(
+        _mm256_or_si256(_mm256_or_si256(eq(v, ' '), eq(v, ',')), in_range(v, '\t', '\r')));
+    }
+
+    [[gnu::target("avx2")]] static uint32_t symbol(char const * const data)
+    {
+      auto const v(load(data));
+      auto special(_mm256_or_si256(eq(v, '"'), eq(v, '(')));
+      special = _mm256_or_si256(special, _mm256_or_si256(eq(v, ')'), eq(v, ',')));
+      special = _mm256_or_si256(special, _mm256_or_si256(eq(v, ';'), in_range(v, '[', '^')));
+      special = _mm256_or_si256(special, _mm256_or_si256(eq(v, '`'), eq(v, '{')));
+      special = _mm256_or_si256(special, eq(v, '}'));
+      return mask(_mm256_andnot_si256(special, in_range(v, '!', '}')));
+    }
+
+    [[gnu::target("avx2")]] static uint32_t string(char const * const data)
+    {
+      auto const v(load(data));
+      auto const special(_mm256_or_si256(eq(v, '"'), eq(v, '\\')));
+      return mask(_mm256_andnot_si256(special, in_range(v, '\x01', '\x7f')));
+    }
+
+    [[gnu::target("avx2")]] static uint32_t newline(char const * const data)
+    {
+      return mask(eq(load(data), '\n'));
+    }
+  }
+
+  static native_bool has_avx2()
+  {
+    static native_bool const ret{ [] {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") != 0;
+    }() };
+    return ret;
+  }
+#endif
+
+  size_t skip_whitespace(native_persistent_string_view const &s, size_t const offset)
+  {
+#if defined(__x86_64__)
+    if(has_avx2())
+    {
+      return skip<avx2::width, avx2::whitespace, is_whitespace>(s.data(), offset, s.size());
+    }
+    return skip<sse2::width, sse2::whitespace, is_whitespace>(s.data(), offset, s.size());
+#else
+    return skip<0, nullptr, is_whitespace>(s.data(), offset, s.size());
+#endif
+  }
+
+  size_t skip_symbol(native_persistent_string_view const &s, size_t const offset)
+  {
+#if defined(__x86_64__)
+    if(has_avx2())
+    {
+      return skip<avx2::width, avx2::symbol, is_symbol>(s.data(), offset, s.size());
+    }
+    return skip<sse2::width, sse2::symbol, is_symbol>(s.data(), offset, s.size());
+#else
+    return skip<0, nullptr, is_symbol>(s.data(), offset, s.size());
+#endif
+  }
+
+  size_t skip_string(native_persistent_string_view const &s, size_t const offset)
+  {
+#if defined(__x86_64__)
+    if(has_avx2())
+    {
+      return skip<avx2::width, avx2::string, is_string>(s.data(), offset, s.size());
+    }
+    return skip<sse2::width, sse2::string, is_string>(s.data(), offset, s.size());
+#else
+    return skip<0, nullptr, is_string>(s.data(), offset, s.size());
+#endif
+  }
+
+  size_t count_newlines(native_persistent_string_view const &s)
+  {
+#if defined(__x86_64__)
+    if(has_avx2())
+    {
+      return count<avx2::width, avx2::newline>(s.data(), s.size());
+    }
+    return count<sse2::width, sse2::newline>(s.data(), s.size());
+#else
+    return count<0, nullptr>(s.data(), s.size());
+#endif
+  }
+}
@@ -19,6 +19,8 @@
 #include <jank/analyze/processor.hpp>
 #include <jank/evaluate.hpp>
 #include <jank/jit/processor.hpp>
+#include <jank/jit/background_compiler.hpp>
+#include <jank/runtime/executor.hpp>
 #include <jank/util/mapped_file.hpp>
 #include <jank/util/process_location.hpp>
 #include <jank/util/clang_format.hpp>
@@ -41,11 +43,27 @@ namespace jank::runtime
 
   context::context(util::cli::options const &opts)
     : jit_prc{ opts }
+    , executor_thread_count{ executor::resolve_thread_count(opts.executor_threads) }
+    , binary_version{ util::binary_version(opts.optimization_level,
+                                           opts.include_dirs,
+                                           opts.define_macros) }
     , binary_cache_dir{ util::binary_cache_dir(opts.optimization_level,
                                                opts.include_dirs,
                                                opts.define_macros) }
     , module_loader{ *this, opts.module_path }
   {
+    if(opts.compile_cache)
+    {
+      compile_cache_dir = fmt::format("{}/objects", util::user_cache_dir());
+    }
+
+    if(0 < opts.jit_threads)
+    {
+      background_jit
+        = std::make_unique<jit::background_compiler>(jit_prc,
+                                                     static_cast<size_t>(opts.jit_threads));
+    }
+
     auto const core(intern_ns(make_box<obj::symbol>("clojure.core")));
 
     auto const file_sym(make_box<obj::symbol>("clojure.core/*file*"));
@@ -98,6 +116,21 @@ namespace jank::runtime
     thread_binding_frames.erase(this);
   }
 
+  executor &context::get_executor()
+  {
+    std::call_once(task_executor_started,
+                   [this] { task_executor = std::make_unique<executor>(executor_thread_count); });
+    return *task_executor;
+  }
+
+  void context::shutdown_executor()
+  {
+    if(task_executor)
+    {
+      task_executor->shutdown();
+    }
+  }
+
   obj::symbol_ptr context::qualify_symbol(obj::symbol_ptr const &sym) const
   {
     obj::symbol_ptr qualified_sym{ sym };
@@ -170,19 +203,44 @@ namespace jank::runtime
 
     object_ptr ret{ obj::nil::nil_const() };
     native_vector<analyze::expression_ptr> exprs{};
-    for(auto const &form : p_prc)
+    /* Lexing is lazy, driven by the parser, so reading a form covers both. Each form then
+     * gets its own region, within which codegen and JIT compilation are nested. */
+    auto it([&] {
+      profile::timer const read_timer{ "read form" };
+      return p_prc.begin();
+    }());
+    for(auto const end(p_prc.end()); it != end;)
     {
-      auto const expr(
-        an_prc.analyze(form.expect_ok().unwrap().ptr, analyze::expression_position::statement));
-      ret = evaluate::eval(expr.expect_ok());
-      exprs.emplace_back(expr.expect_ok());
+      {
+        profile::timer const form_timer{ "eval form" };
+        auto const expr([&] {
+          profile::timer const analyze_timer{ "analyze form" };
+          return an_prc.analyze(it->expect_ok().unwrap().ptr,
+                                analyze::expression_position::statement);
+        }());
+        ret = evaluate::eval(expr.expect_ok());
+        exprs.emplace_back(expr.expect_ok());
+      }
+
+      profile::timer const read_timer{ "read form" };
+      ++it;
     }
 
     if(truthy(compile_files_var->deref()))
     {
-      auto const &module(
+      auto module(
         expect_object<runtime::ns>(intern_var("clojure.core", "*ns*").expect_ok()->deref())
           ->to_string());
+      /* The compile cache loads objects by the loader's name for the module, which needn't
+       * match its ns. Both the load function and the object path need to use that name. */
+      if(!compile_cache_targets.empty() && current_module_var->is_bound())
+      {
+        auto const current_module(runtime::to_string(current_module_var->deref()));
+        if(compile_cache_targets.contains(current_module))
+        {
+          module = current_module;
+        }
+      }
       /* No matter what's in the fn, we'll return nil. */
       exprs.emplace_back(
         make_box<analyze::expression>(analyze::expr::primitive_literal<analyze::expression>{
@@ -296,10 +354,17 @@ namespace jank::runtime
   string_result<void>
   context::write_module(std::unique_ptr<codegen::reusable_context> const codegen_ctx) const
   {
-    profile::timer const timer{ fmt::format("write_module {}", codegen_ctx->module_name) };
-    boost::filesystem::path const module_path{
+    profile::timer const timer{ [&] {
+      return fmt::format("write_module {}", codegen_ctx->module_name);
+    } };
+    boost::filesystem::path module_path{
       fmt::format("{}/{}.o", binary_cache_dir, module::module_to_path(codegen_ctx->module_name))
     };
+    auto const cache_target(compile_cache_targets.find(codegen_ctx->module_name));
+    if(cache_target != compile_cache_targets.end())
+    {
+      module_path = native_transient_string{ cache_target->second };
+    }
     boost::filesystem::create_directories(module_path.parent_path());
 
     /* TODO: Is there a better place for this block of code? */
@@ -484,7 +549,9 @@ namespace jank::runtime
                           native_persistent_string_view const &name,
                           bool const resolved)
   {
-    native_persistent_string resolved_ns{ ns };
+    profile::timer const timer{ "rt intern_keyword" };
+
+    native_persistent_string_view resolved_ns{ ns };
     if(!resolved)
     {
       /* The ns will be an ns alias. */
@@ -503,24 +570,55 @@ namespace jank::runtime
         resolved_ns = current_ns->name->name;
       }
     }
-    return intern_keyword(resolved_ns.empty() ? name : fmt::format("{}/{}", resolved_ns, name));
+
+    auto const kw_hash(hash::combine(hash::string(resolved_ns), hash::string(name)));
+    auto &shard(keyword_shards[kw_hash % keyword_shards.size()]);
+    auto const find_in([&](native_vector<obj::keyword_ptr> const &bucket) {
+      for(auto const kw : bucket)
+      {
+        if(native_persistent_string_view{ kw->sym->name } == name
+           && native_persistent_string_view{ kw->sym->ns } == resolved_ns)
+        {
+          return kw;
+        }
+      }
+      return obj::keyword_ptr{};
+    });
+
+    {
+      std::shared_lock<std::shared_mutex> const lock{ shard.mutex };
+      auto const found(shard.keywords.find(kw_hash));
+      if(found != shard.keywords.end())
+      {
+        if(auto const kw = find_in(found->second))
+        {
+          return kw;
+        }
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> const lock{ shard.mutex };
+    auto &bucket(shard.keywords[kw_hash]);
+    /* Someone else may have interned it while we didn't hold the lock. */
+    if(auto const kw = find_in(bucket))
+    {
+      return kw;
+    }
+
+    bucket.push_back(make_box<obj::keyword>(detail::must_be_interned{}, resolved_ns, name));
+    return bucket.back();
   }
 
   result<obj::keyword_ptr, native_persistent_string>
   context::intern_keyword(native_persistent_string_view const &s)
   {
-    profile::timer const timer{ "rt intern_keyword" };
-
-    auto locked_keywords(keywords.wlock());
-    auto const found(locked_keywords->find(s));
-    if(found != locked_keywords->end())
+    /* This splits the same way as symbols do. */
+    auto const found(s.find('/'));
+    if(found != native_persistent_string_view::npos && s.size() > 1)
     {
-      return found->second;
+      return intern_keyword(s.substr(0, found), s.substr(found + 1));
     }
-
-    auto const res(
-      locked_keywords->emplace(s, make_box<obj::keyword>(detail::must_be_interned{}, s)));
-    return res.first->second;
+    return intern_keyword("", s);
   }
 
   object_ptr context::macroexpand1(object_ptr const o)
@@ -437,6 +437,41 @@ namespace jank::runtime
       o);
   }
 
+  native_bool isa(object_ptr const hierarchy, object_ptr const child, object_ptr const parent)
+  {
+    if(equal(child, parent))
+    {
+      return true;
+    }
+
+    static object_ptr const ancestors{ __rt_ctx->intern_keyword("ancestors").expect_ok() };
+    if(contains(get(get(hierarchy, ancestors), child), parent))
+    {
+      return true;
+    }
+
+    if(child->type != object_type::persistent_vector
+       || parent->type != object_type::persistent_vector)
+    {
+      return false;
+    }
+
+    auto const &child_data(expect_object<obj::persistent_vector>(child)->data);
+    auto const &parent_data(expect_object<obj::persistent_vector>(parent)->data);
+    if(child_data.size() != parent_data.size())
+    {
+      return false;
+    }
+    for(size_t i{}; i < child_data.size(); ++i)
+    {
+      if(!isa(hierarchy, child_data[i], parent_data[i]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   native_hash to_hash(object_ptr const o)
   {
     return visit_object([=](auto const typed_o) -> native_hash { return typed_o->to_hash(); }, o);
@@ -591,6 +626,83 @@ namespace jank::runtime
     return o;
   }
 
+  object_ptr
+  blocking_deref(object_ptr const o, object_ptr const timeout_ms, object_ptr const timeout_val)
+  {
+    return visit_object(
+      [=](auto const typed_o) -> object_ptr {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(behavior::blocking_derefable<T>)
+        {
+          return typed_o->deref(timeout_ms, timeout_val);
+        }
+        else
+        {
+          throw std::runtime_error{ fmt::format("not a blocking reference: {}",
+                                                typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
+  native_bool is_realized(object_ptr const o)
+  {
+    return visit_object(
+      [=](auto const typed_o) -> native_bool {
+        using T = typename decltype(typed_o)::value_type;
+
+        if constexpr(behavior::pending<T>)
+        {
+          return typed_o->is_realized();
+        }
+        else
+        {
+          throw std::runtime_error{ fmt::format("not pending: {}", typed_o->to_string()) };
+        }
+      },
+      o);
+  }
+
+  object_ptr future_call(object_ptr const fn)
+  {
+    return obj::future::create(fn);
+  }
+
+  native_bool is_future(object_ptr const o)
+  {
+    return o->type == object_type::future;
+  }
+
+  native_bool is_future_done(object_ptr const o)
+  {
+    return try_object<obj::future>(o)->is_realized();
+  }
+
+  native_bool future_cancel(object_ptr const o)
+  {
+    return try_object<obj::future>(o)->cancel();
+  }
+
+  native_bool is_future_cancelled(object_ptr const o)
+  {
+    return try_object<obj::future>(o)->is_cancelled();
+  }
+
+  object_ptr promise()
+  {
+    return make_box<obj::promise>();
+  }
+
+  object_ptr deliver(object_ptr const promise, object_ptr const val)
+  {
+    if(try_object<obj::promise>(promise)->deliver(val))
+    {
+      return promise;
+    }
+    return obj::nil::nil_const();
+  }
+
   object_ptr tagged_literal(object_ptr const tag, object_ptr const form)
   {
     return make_box<obj::tagged_literal>(tag, form);
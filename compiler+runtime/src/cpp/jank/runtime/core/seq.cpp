@@ -17,6 +17,7 @@
 #include <jank/runtime/behavior/indexable.hpp>
 #include <jank/runtime/behavior/stackable.hpp>
 #include <jank/runtime/behavior/chunkable.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 #include <jank/runtime/behavior/metadatable.hpp>
 #include <jank/runtime/core.hpp>
 
@@ -720,8 +721,7 @@ namespace jank::runtime
               if constexpr(std::same_as<O, obj::persistent_hash_map>
                            || std::same_as<O, obj::persistent_array_map>
                            || std::same_as<O, obj::transient_hash_map>
-                           //|| std::same_as<O, obj::transient_array_map>
-              )
+                           || std::same_as<O, obj::transient_array_map>)
               {
                 object_ptr ret{ m };
                 for(auto const &pair : typed_other->data)
@@ -1030,17 +1030,57 @@ namespace jank::runtime
   {
     return visit_seqable(
       [](auto const typed_coll, object_ptr const f, object_ptr const init) -> object_ptr {
-        object_ptr res{ init };
-        for(auto it(typed_coll->fresh_seq()); it != nullptr; it = it->next_in_place())
+        using T = typename decltype(typed_coll)::value_type;
+
+        if constexpr(behavior::reducible<T>)
+        {
+          return typed_coll->reduce(f, init);
+        }
+        else
+        {
+          object_ptr res{ init };
+          for(auto it(typed_coll->fresh_seq()); it != nullptr; it = it->next_in_place())
+          {
+            if(behavior::detail::reduce_step(f, res, it->first()))
+            {
+              break;
+            }
+          }
+          return res;
+        }
+      },
+      s,
+      f,
+      init);
+  }
+
+  object_ptr reduce_kv(object_ptr const f, object_ptr const init, object_ptr const s)
+  {
+    return visit_seqable(
+      [](auto const typed_coll, object_ptr const f, object_ptr const init) -> object_ptr {
+        using T = typename decltype(typed_coll)::value_type;
+
+        if constexpr(behavior::kv_reducible<T>)
         {
-          res = dynamic_call(f, res, it->first());
-          if(res->type == object_type::reduced)
+          return typed_coll->reduce_kv(f, init);
+        }
+        else
+        {
+          /* Anything else needs to be a seq of entries. */
+          object_ptr res{ init };
+          for(auto it(typed_coll->fresh_seq()); it != nullptr; it = it->next_in_place())
           {
-            res = expect_object<obj::reduced>(res)->val;
-            break;
+            auto const entry(it->first());
+            if(behavior::detail::reduce_kv_step(f,
+                                                res,
+                                                runtime::nth(entry, make_box(0)),
+                                                runtime::nth(entry, make_box(1))))
+            {
+              break;
+            }
           }
+          return res;
         }
-        return res;
       },
       s,
       f,
@@ -115,98 +115,73 @@ namespace jank::runtime::detail
     hash = 0;
   }
 
-  void native_persistent_array_map::insert_or_assign(object_ptr const key, object_ptr const val)
+  size_t native_persistent_array_map::index_of(object_ptr const key) const
   {
-    if(key->type == runtime::object_type::keyword)
+    /* Most lookups are for keywords, or for the very same key which was inserted, so a
+     * quick pass comparing only pointers finds the key without any calls to equal. Since
+     * keywords are interned, that's the only pass they need. */
+    for(size_t i{}; i < length; i += 2)
     {
-      for(size_t i{}; i < length; i += 2)
+      if(data[i] == key)
       {
-        if(data[i] == key)
-        {
-          data[i + 1] = val;
-          hash = 0;
-          return;
-        }
+        return i;
       }
     }
-    else
+    if(key->type == runtime::object_type::keyword)
     {
-      for(size_t i{}; i < length; i += 2)
+      return length;
+    }
+
+    /* Any keyword we have can't be equal to a key which isn't a keyword, so we skip over
+     * them without calling equal. */
+    for(size_t i{}; i < length; i += 2)
+    {
+      if(data[i]->type != runtime::object_type::keyword && runtime::equal(data[i], key))
       {
-        if(runtime::equal(data[i], key))
-        {
-          data[i + 1] = val;
-          hash = 0;
-          return;
-        }
+        return i;
       }
     }
-    insert_unique(key, val);
+    return length;
   }
 
-  object_ptr native_persistent_array_map::find(object_ptr const key) const
+  void native_persistent_array_map::insert_or_assign(object_ptr const key, object_ptr const val)
   {
-    if(key->type == runtime::object_type::keyword)
+    auto const i(index_of(key));
+    if(i != length)
     {
-      for(size_t i{}; i < length; i += 2)
-      {
-        if(data[i] == key)
-        {
-          return data[i + 1];
-        }
-      }
+      data[i + 1] = val;
+      hash = 0;
+      return;
     }
-    else
+    insert_unique(key, val);
+  }
+
+  object_ptr native_persistent_array_map::find(object_ptr const key) const
+  {
+    auto const i(index_of(key));
+    if(i != length)
     {
-      for(size_t i{}; i < length; i += 2)
-      {
-        if(runtime::equal(data[i], key))
-        {
-          return data[i + 1];
-        }
-      }
+      return data[i + 1];
     }
     return nullptr;
   }
 
   void native_persistent_array_map::erase(object_ptr const key)
   {
-    if(key->type == runtime::object_type::keyword)
+    auto const i(index_of(key));
+    if(i == length)
     {
-      for(size_t i{}; i < length; i += 2)
-      {
-        if(data[i] == key)
-        {
-          for(size_t k{ i + 2 }; k < length; k += 2)
-          {
-            data[k - 2] = data[k];
-            data[k - 1] = data[k + 1];
-          }
-
-          length -= 2;
-          hash = 0;
-          return;
-        }
-      }
+      return;
     }
-    else
-    {
-      for(size_t i{}; i < length; i += 2)
-      {
-        if(runtime::equal(data[i], key))
-        {
-          for(size_t k{ i + 2 }; k < length; k += 2)
-          {
-            data[k - 2] = data[k];
-            data[k - 1] = data[k + 1];
-          }
 
-          length -= 2;
-          hash = 0;
-          return;
-        }
-      }
+    for(size_t k{ i + 2 }; k < length; k += 2)
+    {
+      data[k - 2] = data[k];
+      data[k - 1] = data[k + 1];
     }
+
+    length -= 2;
+    hash = 0;
   }
 
   native_hash native_persistent_array_map::to_hash() const
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <list>
+
+#include <jank/runtime/executor.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/util/gc_thread.hpp>
+
+namespace jank::runtime
+{
+  /* Which executor, if any, the current thread belongs to, and which queue is its own. */
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static thread_local executor *current_executor{};
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static thread_local size_t current_index{};
+
+  /* Helpers, from every executor, sleep on these. Every submission, and every call to
+   * notify_helpers, moves the generation along, but the lock is only taken to wake them
+   * when some could be sleeping. */
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<size_t> help_generation_count{};
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<size_t> sleeping_helpers{};
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::mutex help_mutex;
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::condition_variable help_wanted;
+
+  executor::executor(size_t const thread_count)
+    : thread_count{ thread_count }
+  {
+    /* Every queue needs to exist before any thread starts stealing from them. */
+    for(size_t i{}; i <= thread_count; ++i)
+    {
+      queues.emplace_back();
+    }
+
+    for(size_t i{}; i < thread_count; ++i)
+    {
+      threads.emplace_back([this, i] {
+        /* Our tasks allocate GC objects, so we need to be registered with the GC. */
+        util::gc_thread_scope const gc_thread;
+        work(i);
+      });
+    }
+  }
+
+  executor::~executor()
+  {
+    shutdown();
+  }
+
+  void executor::shutdown()
+  {
+    std::call_once(stopped, [this] {
+      {
+        std::lock_guard<std::mutex> const lock{ sleep_mutex };
+        stopping = true;
+      }
+      task_available.notify_all();
+
+      for(auto &thread : threads)
+      {
+        thread.join();
+      }
+    });
+  }
+
+  size_t executor::resolve_thread_count(native_integer const requested)
+  {
+    if(0 < requested)
+    {
+      return static_cast<size_t>(requested);
+    }
+    /* This may not be known, in which case it's 0. */
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  native_bool executor::is_worker_thread()
+  {
+    return current_executor != nullptr;
+  }
+
+  native_bool executor::help(std::unique_lock<std::mutex> &lock)
+  {
+    lock.unlock();
+    auto const t(current_executor->take(current_index));
+    if(t.is_some())
+    {
+      current_executor->queued.fetch_sub(1);
+
+      /* The task should run just as it would on an idle thread, without the bindings of
+       * whatever is blocked beneath it. */
+      std::list<thread_binding_frame> blocked;
+      blocked.swap(context::thread_binding_frames[__rt_ctx]);
+      t.unwrap().run(t.unwrap().arg);
+      blocked.swap(context::thread_binding_frames[__rt_ctx]);
+    }
+    lock.lock();
+    return t.is_some();
+  }
+
+  size_t executor::help_generation()
+  {
+    return help_generation_count.load();
+  }
+
+  void executor::sleep(std::unique_lock<std::mutex> &lock, size_t const seen)
+  {
+    lock.unlock();
+    sleeping_helpers.fetch_add(1);
+    {
+      std::unique_lock<std::mutex> help_lock{ help_mutex };
+      help_wanted.wait(help_lock, [seen] { return help_generation_count.load() != seen; });
+    }
+    sleeping_helpers.fetch_sub(1);
+    lock.lock();
+  }
+
+  void executor::sleep_until(std::unique_lock<std::mutex> &lock,
+                             size_t const seen,
+                             std::chrono::steady_clock::time_point const deadline)
+  {
+    lock.unlock();
+    sleeping_helpers.fetch_add(1);
+    {
+      std::unique_lock<std::mutex> help_lock{ help_mutex };
+      help_wanted.wait_until(help_lock, deadline, [seen] {
+        return help_generation_count.load() != seen;
+      });
+    }
+    sleeping_helpers.fetch_sub(1);
+    lock.lock();
+  }
+
+  void executor::notify_helpers()
+  {
+    help_generation_count.fetch_add(1);
+    /* A helper counts itself as sleeping before it checks the generation, so either we see
+     * it here or it sees the new generation. */
+    if(sleeping_helpers.load() == 0)
+    {
+      return;
+    }
+
+    /* Helpers check the generation while holding this lock, so taking it here means we
+     * can't notify between one of them checking and it starting to wait. */
+    {
+      std::lock_guard<std::mutex> const lock{ help_mutex };
+    }
+    help_wanted.notify_all();
+  }
+
+  void executor::submit(task const &t)
+  {
+    /* This is counted first, so it can't go negative when the task is taken before we
+     * get here. At worst, an idle thread looks once more before sleeping. */
+    queued.fetch_add(1);
+
+    auto &q(current_executor == this ? queues[current_index] : queues.back());
+    {
+      std::lock_guard<std::mutex> const lock{ q.mutex };
+      q.tasks.push_back(t);
+    }
+
+    /* Sleeping threads check the count while holding this lock, so taking it here means
+     * we can't notify between one of them checking and it starting to wait. */
+    {
+      std::lock_guard<std::mutex> const lock{ sleep_mutex };
+    }
+    task_available.notify_one();
+
+    /* Threads which are blocked on a deref can run this, too. */
+    notify_helpers();
+  }
+
+  option<executor::task> executor::take(size_t const index)
+  {
+    {
+      auto &own(queues[index]);
+      std::lock_guard<std::mutex> const lock{ own.mutex };
+      if(!own.tasks.empty())
+      {
+        auto const ret(own.tasks.back());
+        own.tasks.pop_back();
+        return ret;
+      }
+    }
+
+    /* Starting with our neighbor spreads the thieves out, rather than having them all
+     * fight over the same queue. */
+    for(size_t i{ 1 }; i < queues.size(); ++i)
+    {
+      auto &victim(queues[(index + i) % queues.size()]);
+      std::lock_guard<std::mutex> const lock{ victim.mutex };
+      if(!victim.tasks.empty())
+      {
+        auto const ret(victim.tasks.front());
+        victim.tasks.pop_front();
+        return ret;
+      }
+    }
+
+    return none;
+  }
+
+  void executor::work(size_t const index)
+  {
+    current_executor = this;
+    current_index = index;
+
+    while(true)
+    {
+      auto const t(take(index));
+      if(t.is_some())
+      {
+        queued.fetch_sub(1);
+        t.unwrap().run(t.unwrap().arg);
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock{ sleep_mutex };
+      task_available.wait(lock, [this] { return stopping || queued.load() != 0; });
+      if(stopping && queued.load() == 0)
+      {
+        return;
+      }
+    }
+  }
+}
@@ -1,6 +1,9 @@
 #include <boost/filesystem/operations.hpp>
 #include <regex>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
 
 #include <libzippp.h>
 
@@ -10,6 +13,8 @@
 
 #include <jank/util/mapped_file.hpp>
 #include <jank/util/process_location.hpp>
+#include <jank/util/scope_exit.hpp>
+#include <jank/util/sha256.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/core/munge.hpp>
 #include <jank/runtime/core/truthy.hpp>
@@ -20,6 +25,7 @@
 #include <jank/runtime/obj/persistent_sorted_set.hpp>
 #include <jank/runtime/module/loader.hpp>
 #include <jank/runtime/rtti.hpp>
+#include <jank/jit/background_compiler.hpp>
 #include <jank/profile/time.hpp>
 #include <jank/native_persistent_string/fmt.hpp>
 
@@ -316,6 +322,12 @@ namespace jank::runtime::module
     }
   }
 
+  void loader::add_path(native_persistent_string_view const &path)
+  {
+    paths = fmt::format("{}{}{}", paths, module_separator, path);
+    register_path(entries, path);
+  }
+
   object_ptr file_entry::to_runtime_data() const
   {
     return runtime::obj::persistent_array_map::create_unique(
@@ -463,8 +475,37 @@ namespace jank::runtime::module
     loaded_libs_atom->swap(swap_fn_wrapper);
   }
 
+  static string_result<native_persistent_string> read_entry(file_entry const &entry)
+  {
+    if(entry.archive_path.is_some())
+    {
+      native_persistent_string ret;
+      visit_jar_entry(entry, [&](auto const &zip_entry) { ret = zip_entry.readAsText(); });
+      return ok(ret);
+    }
+
+    auto const file(util::map_file(entry.path));
+    if(file.is_err())
+    {
+      return err(
+        fmt::format("unable to map file {} due to error: {}", entry.path, file.expect_err()));
+    }
+    return ok(native_persistent_string{ file.expect_ok().head, file.expect_ok().size });
+  }
+
   string_result<void> loader::load(native_persistent_string_view const &module, origin const ori)
   {
+    /* The compile cache needs to know everything which a module requires, including what has
+     * already been loaded. */
+    if(rt_ctx.compile_cache_dir.is_some() && rt_ctx.current_module_var->is_bound())
+    {
+      auto const requiring(runtime::to_string(rt_ctx.current_module_var->deref()));
+      if(requiring != module && rt_ctx.compile_cache_targets.contains(requiring))
+      {
+        rt_ctx.module_dependencies[requiring].emplace_back(native_persistent_string{ module });
+      }
+    }
+
     if(ori != origin::source && loader::is_loaded(module))
     {
       return ok();
@@ -476,6 +517,8 @@ namespace jank::runtime::module
       return err(found_module.expect_err());
     }
 
+    /* Anything submitted to the background JIT before this is someone else's to report. */
+    auto const jit_checkpoint(rt_ctx.background_jit ? rt_ctx.background_jit->checkpoint() : 0);
     string_result<void> res(err(fmt::format("Couldn't load module: {}", module)));
 
     auto const module_type_to_load{ found_module.expect_ok().to_load.unwrap() };
@@ -484,7 +527,7 @@ namespace jank::runtime::module
     switch(module_type_to_load)
     {
       case module_type::jank:
-        res = load_jank(module_sources.jank.unwrap());
+        res = load_jank(module, module_sources.jank.unwrap());
         break;
       case module_type::o:
         res = load_o(module, module_sources.o.unwrap());
@@ -493,7 +536,7 @@ namespace jank::runtime::module
         res = load_cpp(module_sources.cpp.unwrap());
         break;
       case module_type::cljc:
-        res = load_cljc(module_sources.cljc.unwrap());
+        res = load_cljc(module, module_sources.cljc.unwrap());
         break;
     }
 
@@ -502,6 +545,31 @@ namespace jank::runtime::module
       return res;
     }
 
+    /* Modules loaded from source have their hashes recorded by load_cached. Anything else
+     * could still be a dependency of a cached object, so we hash what we loaded. */
+    if(rt_ctx.compile_cache_dir.is_some()
+       && (module_type_to_load == module_type::o || module_type_to_load == module_type::cpp))
+    {
+      auto const loaded(read_entry(module_type_to_load == module_type::o
+                                     ? module_sources.o.unwrap()
+                                     : module_sources.cpp.unwrap()));
+      if(loaded.is_ok())
+      {
+        rt_ctx.compile_cache_hashes[native_persistent_string{ module }]
+          = util::sha256(loaded.expect_ok());
+      }
+    }
+
+    /* A module isn't loaded until all of its fns are. */
+    if(rt_ctx.background_jit)
+    {
+      res = rt_ctx.background_jit->join(jit_checkpoint);
+      if(res.is_err())
+      {
+        return res;
+      }
+    }
+
     loader::set_is_loaded(module);
     return ok();
   }
@@ -509,7 +577,7 @@ namespace jank::runtime::module
   string_result<void>
   loader::load_o(native_persistent_string const &module, file_entry const &entry) const
   {
-    profile::timer const timer{ fmt::format("load object {}", module) };
+    profile::timer const timer{ [&] { return fmt::format("load object {}", module); } };
 
     /* While loading an object, if the main ns loading symbol exists, then
      * we don't need to load the object file again.
@@ -543,6 +611,214 @@ namespace jank::runtime::module
     return ok();
   }
 
+  /* Each cached object is keyed by its module's source and by the hash which each module it
+   * required had when it was compiled. A module's hash is the key of its object, so it covers
+   * that module's own dependencies as well. This catches changes anywhere beneath the module,
+   * such as a macro whose old expansion is baked into the object. An object is kept for each
+   * version of the dependencies, so going back to an older one doesn't mean compiling again.
+   *
+   * Returns none if a dependency has no hash, since there's nothing to key on. */
+  static option<native_persistent_string>
+  cached_object_key(context const &rt_ctx,
+                    native_persistent_string const &source_key,
+                    native_vector<native_persistent_string> const &dependencies)
+  {
+    util::string_builder sb;
+    sb(source_key);
+    for(auto const &dependency : dependencies)
+    {
+      auto const found(rt_ctx.compile_cache_hashes.find(dependency));
+      if(found == rt_ctx.compile_cache_hashes.end())
+      {
+        return none;
+      }
+      sb("\n")(dependency)(" ")(found->second);
+    }
+    return util::sha256(sb.release());
+  }
+
+  /* The dependencies aren't known until the module has been evaluated, so they're listed in
+   * a manifest which is keyed by the source alone. There's a line for each module. */
+  static string_result<native_vector<native_persistent_string>>
+  read_cache_manifest(boost::filesystem::path const &manifest_path)
+  {
+    auto const manifest(read_entry(file_entry{ none, manifest_path.string() }));
+    if(manifest.is_err())
+    {
+      return err(manifest.expect_err());
+    }
+
+    native_vector<native_persistent_string> dependencies;
+    std::istringstream lines{ std::string{ manifest.expect_ok() } };
+    std::string dependency;
+    while(lines >> dependency)
+    {
+      dependencies.emplace_back(dependency);
+    }
+    return ok(std::move(dependencies));
+  }
+
+  static native_vector<native_persistent_string>
+  cache_dependencies(context &rt_ctx, native_persistent_string const &module)
+  {
+    auto dependencies(rt_ctx.module_dependencies[module]);
+    std::ranges::sort(dependencies);
+    auto const last(std::ranges::unique(dependencies));
+    dependencies.erase(last.begin(), last.end());
+
+    /* Modules loaded before the compile cache was enabled have no hash, so there's nothing
+     * we could key on for them. */
+    auto const unhashed(std::ranges::remove_if(dependencies, [&](auto const &dependency) {
+      return rt_ctx.compile_cache_hashes.find(dependency) == rt_ctx.compile_cache_hashes.end();
+    }));
+    dependencies.erase(unhashed.begin(), unhashed.end());
+    return dependencies;
+  }
+
+  /* Renames a file which we've finished writing into the cache. Other processes may be racing
+   * us to write the same file; since they would write the same contents, whoever wins is
+   * fine. Otherwise, the next run would just compile it again, so a failure here isn't fatal,
+   * but we don't want it to go unnoticed either. */
+  static void
+  publish_cache_file(boost::filesystem::path const &tmp_path, boost::filesystem::path const &path)
+  {
+    boost::system::error_code rename_error;
+    boost::filesystem::rename(tmp_path, path, rename_error);
+    if(!rename_error)
+    {
+      return;
+    }
+
+    boost::system::error_code remove_error;
+    boost::filesystem::remove(tmp_path, remove_error);
+    if(!boost::filesystem::exists(path))
+    {
+      std::cerr << fmt::format("Failed to write {} to the compile cache: {}\n",
+                               path.string(),
+                               rename_error.message());
+    }
+  }
+
+  /* With the compile cache enabled, we look for an object compiled from this exact source,
+   * with these exact dependencies. If there is one, we load it and we're done. If not, we
+   * evaluate the source while compiling it into the cache, so the next load can skip lexing,
+   * parsing, analysis, and codegen.
+   *
+   * Returns whether or not this took care of loading the module. */
+  string_result<native_bool>
+  loader::load_cached(native_persistent_string const &module, file_entry const &entry) const
+  {
+    /* If there are no cache targets, but we're compiling files, this is an AOT compilation
+     * which wants its objects in the binary cache dir instead. */
+    if(rt_ctx.compile_cache_dir.is_none()
+       || (rt_ctx.compile_cache_targets.empty() && truthy(rt_ctx.compile_files_var->deref())))
+    {
+      return ok(false);
+    }
+
+    auto const read(read_entry(entry));
+    if(read.is_err())
+    {
+      return err(read.expect_err());
+    }
+    auto const &source(read.expect_ok());
+
+    auto const key(
+      util::sha256(fmt::format("{}.{}.{}", rt_ctx.binary_version, module, source)));
+    auto const &cache_dir(rt_ctx.compile_cache_dir.unwrap());
+    boost::filesystem::path const manifest_path{ fmt::format("{}/{}.deps", cache_dir, key) };
+
+    if(boost::filesystem::exists(manifest_path))
+    {
+      auto const dependencies(read_cache_manifest(manifest_path));
+      if(dependencies.is_err())
+      {
+        return err(dependencies.expect_err());
+      }
+
+      /* The object would load these first thing anyway. */
+      for(auto const &dependency : dependencies.expect_ok())
+      {
+        auto const res(rt_ctx.load_module(fmt::format("/{}", dependency), origin::latest));
+        if(res.is_err())
+        {
+          return err(res.expect_err());
+        }
+      }
+
+      auto const object_key(cached_object_key(rt_ctx, key, dependencies.expect_ok()));
+      if(object_key.is_some())
+      {
+        boost::filesystem::path const object_path{
+          fmt::format("{}/{}.o", cache_dir, object_key.unwrap())
+        };
+        if(boost::filesystem::exists(object_path))
+        {
+          profile::timer const timer{ [&] {
+            return fmt::format("load cached object {}", module);
+          } };
+          auto const res(load_o(module, file_entry{ none, object_path.string() }));
+          if(res.is_err())
+          {
+            return err(res.expect_err());
+          }
+
+          rt_ctx.compile_cache_hashes[module] = object_key.unwrap();
+          return ok(true);
+        }
+      }
+    }
+
+    profile::timer const timer{ [&] { return fmt::format("compile cached object {}", module); } };
+
+    /* We write to temporary files first, so that nobody else will ever load a partially
+     * written object. The object's key isn't known until we know its dependencies. */
+    auto const tmp_suffix(boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp").string());
+    auto const tmp_object_path(fmt::format("{}/{}.o{}", cache_dir, key, tmp_suffix));
+    auto const tmp_manifest_path(manifest_path.string() + tmp_suffix);
+    boost::filesystem::create_directories(manifest_path.parent_path());
+    rt_ctx.compile_cache_targets[module] = tmp_object_path;
+    rt_ctx.module_dependencies[module].clear();
+    util::scope_exit const done{ [&] {
+      rt_ctx.compile_cache_targets.erase(module);
+      rt_ctx.module_dependencies.erase(module);
+    } };
+
+    {
+      context::binding_scope const preserve{ rt_ctx,
+                                             obj::persistent_hash_map::create_unique(
+                                               std::make_pair(rt_ctx.compile_files_var,
+                                                              obj::boolean::true_const()),
+                                               std::make_pair(rt_ctx.current_module_var,
+                                                              make_box(module))) };
+
+      if(entry.archive_path.is_some())
+      {
+        rt_ctx.eval_string({ source.data(), source.size() });
+      }
+      else
+      {
+        rt_ctx.eval_file(entry.path);
+      }
+    }
+
+    auto const dependencies(cache_dependencies(rt_ctx, module));
+    {
+      std::ofstream manifest_file{ tmp_manifest_path };
+      for(auto const &dependency : dependencies)
+      {
+        manifest_file << fmt::format("{}\n", dependency);
+      }
+    }
+    /* Every dependency we kept has a hash, so this always has a key. */
+    auto const object_key(cached_object_key(rt_ctx, key, dependencies).unwrap());
+    publish_cache_file(tmp_manifest_path, manifest_path);
+    publish_cache_file(tmp_object_path, fmt::format("{}/{}.o", cache_dir, object_key));
+
+    rt_ctx.compile_cache_hashes[module] = object_key;
+    return ok(true);
+  }
+
   string_result<void> loader::load_cpp(file_entry const &entry) const
   {
     if(entry.archive_path.is_some())
@@ -565,8 +841,19 @@ namespace jank::runtime::module
     return ok();
   }
 
-  string_result<void> loader::load_jank(file_entry const &entry) const
+  string_result<void>
+  loader::load_jank(native_persistent_string const &module, file_entry const &entry) const
   {
+    auto const cached(load_cached(module, entry));
+    if(cached.is_err())
+    {
+      return err(cached.expect_err());
+    }
+    else if(cached.expect_ok())
+    {
+      return ok();
+    }
+
     if(entry.archive_path.is_some())
     {
       visit_jar_entry(entry,
@@ -580,9 +867,10 @@ namespace jank::runtime::module
     return ok();
   }
 
-  string_result<void> loader::load_cljc(file_entry const &entry) const
+  string_result<void>
+  loader::load_cljc(native_persistent_string const &module, file_entry const &entry) const
   {
-    return loader::load_jank(entry);
+    return loader::load_jank(module, entry);
   }
 
   object_ptr loader::to_runtime_data() const
@@ -10,17 +10,30 @@ namespace jank::runtime::obj
 {
   array_chunk::array_chunk(native_vector<object_ptr> const &buffer)
     : buffer{ buffer }
+    , data{ this->buffer.data() }
+    , size{ this->buffer.size() }
   {
   }
 
   array_chunk::array_chunk(native_vector<object_ptr> const &buffer, size_t const offset)
     : buffer{ buffer }
+    , data{ this->buffer.data() }
+    , size{ this->buffer.size() }
     , offset{ offset }
   {
   }
 
   array_chunk::array_chunk(native_vector<object_ptr> &&buffer, size_t const offset)
     : buffer{ std::move(buffer) }
+    , data{ this->buffer.data() }
+    , size{ this->buffer.size() }
+    , offset{ offset }
+  {
+  }
+
+  array_chunk::array_chunk(object_ptr const * const data, size_t const size, size_t const offset)
+    : data{ data }
+    , size{ size }
     , offset{ offset }
   {
   }
@@ -54,17 +67,17 @@ namespace jank::runtime::obj
 
   array_chunk_ptr array_chunk::chunk_next() const
   {
-    if(offset == buffer.size())
+    if(offset == size)
     {
       throw std::runtime_error{ "no more chunk remaining to chunk_next" };
     }
-    /* TODO: This copying will be slow. Use a persistent_vector? */
-    return make_box<array_chunk>(buffer, offset + 1);
+    /* Our elements are never modified, so the next chunk can share them. */
+    return make_box<array_chunk>(data, size, offset + 1);
   }
 
   array_chunk_ptr array_chunk::chunk_next_in_place()
   {
-    if(offset == buffer.size())
+    if(offset == size)
     {
       throw std::runtime_error{ "no more chunk remaining to chunk_next" };
     }
@@ -74,7 +87,7 @@ namespace jank::runtime::obj
 
   size_t array_chunk::count() const
   {
-    return buffer.size() - offset;
+    return size - offset;
   }
 
   object_ptr array_chunk::nth(object_ptr const index) const
@@ -82,15 +95,15 @@ namespace jank::runtime::obj
     if(index->type == object_type::integer)
     {
       auto const i(expect_object<integer>(index)->data);
-      if(i < 0 || buffer.size() - offset <= static_cast<size_t>(i))
+      if(i < 0 || size - offset <= static_cast<size_t>(i))
       {
         throw std::runtime_error{ fmt::format(
           "out of bounds index {}; array_chunk has a size of {} and offset of {}",
           i,
-          buffer.size(),
+          size,
           offset) };
       }
-      return buffer[offset + i];
+      return data[offset + i];
     }
     else
     {
@@ -104,11 +117,11 @@ namespace jank::runtime::obj
     if(index->type == object_type::integer)
     {
       auto const i(expect_object<integer>(index)->data);
-      if(i < 0 || buffer.size() - offset <= static_cast<size_t>(i))
+      if(i < 0 || size - offset <= static_cast<size_t>(i))
       {
         return fallback;
       }
-      return buffer[offset + i];
+      return data[offset + i];
     }
     else
     {
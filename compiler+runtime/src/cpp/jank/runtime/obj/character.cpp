@@ -1,3 +1,5 @@
+#include <array>
+
 #include <fmt/format.h>
 
 #include <jank/runtime/obj/character.hpp>
@@ -35,6 +37,27 @@ namespace jank::runtime::obj
     }
   }
 
+  character_ptr character::create(char const ch)
+  {
+    /* These are allocated as uncollectable, so they stay alive without the cache itself
+     * needing to be scanned as a GC root. */
+    static auto const cache{ [] {
+      std::array<character_ptr, 128> ret;
+      for(size_t i{}; i < ret.size(); ++i)
+      {
+        ret[i] = new(NoGC) character{ static_cast<char>(i) };
+      }
+      return ret;
+    }() };
+
+    auto const index(static_cast<unsigned char>(ch));
+    if(index < cache.size())
+    {
+      return cache[index];
+    }
+    return make_box<character>(ch);
+  }
+
   character::character(native_persistent_string const &d)
     : data{ d }
   {
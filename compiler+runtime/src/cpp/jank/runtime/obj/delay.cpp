@@ -67,4 +67,10 @@ namespace jank::runtime::obj
     }
     return val;
   }
+
+  native_bool delay::is_realized()
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    return val != nullptr || error != nullptr;
+  }
 }
@@ -1,6 +1,7 @@
 #include <jank/runtime/obj/detail/base_persistent_map.hpp>
 #include <jank/runtime/behavior/associatively_readable.hpp>
 #include <jank/runtime/behavior/map_like.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 #include <jank/runtime/visit.hpp>
 
 namespace jank::runtime::obj::detail
@@ -154,6 +155,38 @@ namespace jank::runtime::obj::detail
     return static_cast<PT const *>(this)->data.size();
   }
 
+  template <typename PT, typename ST, typename V>
+  object_ptr
+  base_persistent_map<PT, ST, V>::reduce(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    for(auto const &entry : static_cast<PT const *>(this)->data)
+    {
+      auto const e(make_box<obj::persistent_vector>(
+        runtime::detail::native_persistent_vector{ entry.first, entry.second }));
+      if(behavior::detail::reduce_step(f, acc, e))
+      {
+        break;
+      }
+    }
+    return acc;
+  }
+
+  template <typename PT, typename ST, typename V>
+  object_ptr
+  base_persistent_map<PT, ST, V>::reduce_kv(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    for(auto const &entry : static_cast<PT const *>(this)->data)
+    {
+      if(behavior::detail::reduce_kv_step(f, acc, entry.first, entry.second))
+      {
+        break;
+      }
+    }
+    return acc;
+  }
+
   template <typename PT, typename ST, typename V>
   native_box<PT> base_persistent_map<PT, ST, V>::with_meta(object_ptr const m) const
   {
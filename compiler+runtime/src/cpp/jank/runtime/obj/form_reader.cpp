@@ -0,0 +1,120 @@
+#include <fmt/format.h>
+
+#include <jank/native_persistent_string/fmt.hpp>
+#include <jank/runtime/obj/form_reader.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/util/escape.hpp>
+
+namespace jank::runtime::obj
+{
+  static native_persistent_string_view view_of(util::mapped_file const &file)
+  {
+    return { file.head, file.size };
+  }
+
+  form_reader::form_reader(native_persistent_string const &path, util::mapped_file &&file)
+    : path{ path }
+    , file{ std::make_unique<util::mapped_file>(std::move(file)) }
+    , lexer{ view_of(*this->file) }
+    , parser{ lexer.begin(), lexer.end() }
+  {
+    this->file->advise_sequential();
+  }
+
+  form_reader::form_reader(persistent_string_ptr const source)
+    : source{ source }
+    , lexer{ source->data }
+    , parser{ lexer.begin(), lexer.end() }
+  {
+  }
+
+  result<form_reader_ptr, native_persistent_string>
+  form_reader::open(native_persistent_string const &path)
+  {
+    auto file(util::map_file({ path.data(), path.size() }));
+    if(file.is_err())
+    {
+      return err(fmt::format("Unable to read {}: {}", path, file.expect_err()));
+    }
+    return make_box<form_reader>(path, std::move(file.expect_ok_move()));
+  }
+
+  native_bool form_reader::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  native_persistent_string form_reader::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void form_reader::to_string(util::string_builder &buff) const
+  {
+    if(source.data)
+    {
+      fmt::format_to(std::back_inserter(buff),
+                     "{}@{}",
+                     object_type_str(base.type),
+                     fmt::ptr(&base));
+    }
+    else
+    {
+      fmt::format_to(std::back_inserter(buff),
+                     "{}@{} {}",
+                     object_type_str(base.type),
+                     fmt::ptr(&base),
+                     util::escaped_quoted_view(path));
+    }
+  }
+
+  native_persistent_string form_reader::to_code_string() const
+  {
+    return to_string();
+  }
+
+  native_hash form_reader::to_hash() const
+  {
+    return static_cast<native_hash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  object_ptr form_reader::read(object_ptr const eof)
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    if(closed)
+    {
+      return eof;
+    }
+
+    auto const res(parser.next());
+    if(res.is_err())
+    {
+      throw res.expect_err();
+    }
+    if(res.expect_ok().is_none())
+    {
+      return eof;
+    }
+
+    /* Forms don't refer back into the source, so the pages we've read past can go. Since the
+     * parser may have looked ahead a token, we only release what's before this form. */
+    auto const offset(res.expect_ok().unwrap().start.offset);
+    if(file && offset - released >= release_threshold)
+    {
+      file->release(released, offset - released);
+      released = offset;
+    }
+
+    return res.expect_ok().unwrap().ptr;
+  }
+
+  void form_reader::close()
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    closed = true;
+    file.reset();
+  }
+}
@@ -0,0 +1,164 @@
+#include <fmt/format.h>
+
+#include <jank/runtime/obj/future.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/behavior/callable.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/executor.hpp>
+
+namespace jank::runtime::obj
+{
+  future::future(object_ptr const fn, obj::persistent_hash_map_ptr const bindings)
+    : fn{ fn }
+    , bindings{ bindings }
+  {
+  }
+
+  future_ptr future::create(object_ptr const fn)
+  {
+    auto const ret(make_box<future>(fn, __rt_ctx->get_thread_bindings()));
+    __rt_ctx->get_executor().submit(
+      { [](object_ptr const o) { expect_object<future>(o)->run(); }, ret });
+    return ret;
+  }
+
+  native_bool future::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  native_persistent_string future::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void future::to_string(util::string_builder &buff) const
+  {
+    fmt::format_to(std::back_inserter(buff), "{}@{}", object_type_str(base.type), fmt::ptr(&base));
+  }
+
+  native_persistent_string future::to_code_string() const
+  {
+    return to_string();
+  }
+
+  native_hash future::to_hash() const
+  {
+    return static_cast<native_hash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  object_ptr future::deref()
+  {
+    /* Rather than waiting for an executor thread to get to us, we can do the work
+     * ourselves. This also means a future which derefs another never waits on a task which
+     * is still queued. If it's already running elsewhere, we help the executor meanwhile. */
+    run();
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    executor::wait(lock, finished, [this] { return is_realized(); });
+    return result();
+  }
+
+  object_ptr future::deref(object_ptr const timeout_ms, object_ptr const timeout_val)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    if(!executor::wait_for(lock,
+                           finished,
+                           std::chrono::milliseconds{ to_int(timeout_ms) },
+                           [this] { return is_realized(); }))
+    {
+      return timeout_val;
+    }
+    return result();
+  }
+
+  native_bool future::is_realized()
+  {
+    auto const s(current.load());
+    return s != state::pending && s != state::running;
+  }
+
+  void future::run()
+  {
+    auto expected(state::pending);
+    if(!current.compare_exchange_strong(expected, state::running))
+    {
+      return;
+    }
+
+    auto s(state::done);
+    try
+    {
+      context::binding_scope const scope{ *__rt_ctx, bindings };
+      val = dynamic_call(fn);
+    }
+    catch(std::exception const &e)
+    {
+      error = make_box(e.what());
+      s = state::failed;
+    }
+    catch(object_ptr const e)
+    {
+      error = e;
+      s = state::failed;
+    }
+    catch(...)
+    {
+      error = make_box("unknown exception");
+      s = state::failed;
+    }
+    finish(s);
+  }
+
+  native_bool future::cancel()
+  {
+    auto expected(state::pending);
+    if(!current.compare_exchange_strong(expected, state::cancelled))
+    {
+      return false;
+    }
+    finish(state::cancelled);
+    return true;
+  }
+
+  native_bool future::is_cancelled() const
+  {
+    return current.load() == state::cancelled;
+  }
+
+  object_ptr future::result() const
+  {
+    switch(current.load())
+    {
+      case state::done:
+        return val;
+      case state::failed:
+        throw error;
+      case state::cancelled:
+        throw std::runtime_error{ "future was cancelled" };
+      case state::pending:
+      case state::running:
+        break;
+    }
+    throw std::runtime_error{ "future is not yet realized" };
+  }
+
+  void future::finish(state const s)
+  {
+    /* Neither is needed anymore, so we let the GC have them. */
+    fn = nullptr;
+    bindings = nullptr;
+
+    /* Waiters check the state while holding the lock, so they can't miss this. */
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      current.store(s);
+    }
+    finished.notify_all();
+    executor::notify_helpers();
+  }
+}
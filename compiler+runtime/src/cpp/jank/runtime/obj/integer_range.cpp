@@ -3,6 +3,7 @@
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/behavior/metadatable.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 
 namespace jank::runtime::obj
 {
@@ -17,9 +18,9 @@ namespace jank::runtime::obj
   }
 
   integer_range::integer_range(integer_ptr const end)
-    : start{ make_box<integer>(0) }
+    : start{ make_box(0) }
     , end{ end }
-    , step{ make_box<integer>(1) }
+    , step{ make_box(1) }
     , bounds_check{ positive_step_bounds_check }
   {
   }
@@ -27,7 +28,7 @@ namespace jank::runtime::obj
   integer_range::integer_range(integer_ptr const start, integer_ptr const end)
     : start{ start }
     , end{ end }
-    , step{ make_box<integer>(1) }
+    , step{ make_box(1) }
     , bounds_check{ positive_step_bounds_check }
   {
   }
@@ -58,9 +59,9 @@ namespace jank::runtime::obj
   {
     if(is_pos(end))
     {
-      return make_box<integer_range>(make_box<integer>(0),
+      return make_box<integer_range>(make_box(0),
                                      end,
-                                     make_box<integer>(1),
+                                     make_box(1),
                                      positive_step_bounds_check);
     }
     return persistent_list::empty();
@@ -68,7 +69,7 @@ namespace jank::runtime::obj
 
   object_ptr integer_range::create(integer_ptr const start, integer_ptr const end)
   {
-    return create(start, end, make_box<integer>(1));
+    return create(start, end, make_box(1));
   }
 
   object_ptr
@@ -80,7 +81,7 @@ namespace jank::runtime::obj
     }
     else if(is_zero(step))
     {
-      return repeat::create(make_box<integer>(start));
+      return repeat::create(make_box(start));
     }
     return make_box<integer_range>(start,
                                    end,
@@ -110,7 +111,7 @@ namespace jank::runtime::obj
     {
       return nullptr;
     }
-    return make_box<integer_range>(make_box<integer>(add(start, step)), end, step, bounds_check);
+    return make_box<integer_range>(make_box(add(start, step)), end, step, bounds_check);
   }
 
   integer_range_ptr integer_range::next_in_place()
@@ -119,10 +120,25 @@ namespace jank::runtime::obj
     {
       return nullptr;
     }
-    start = make_box<integer>(add(start, step));
+    start = make_box(add(start, step));
     return this;
   }
 
+  object_ptr integer_range::reduce(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    auto const n(count());
+    auto i(start->data);
+    for(size_t c{}; c < n; ++c, i += step->data)
+    {
+      if(behavior::detail::reduce_step(f, acc, make_box(i)))
+      {
+        break;
+      }
+    }
+    return acc;
+  }
+
   cons_ptr integer_range::conj(object_ptr const head) const
   {
     return make_box<cons>(head, this);
@@ -10,6 +10,15 @@
 
 namespace jank::runtime::obj
 {
+  /* Each thread's token is the address of something only it has, so it can't be mistaken
+   * for another thread's, or for one of the other states. */
+  static uintptr_t thread_token()
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+    static thread_local char token{};
+    return reinterpret_cast<uintptr_t>(&token);
+  }
+
   lazy_sequence::lazy_sequence(object_ptr const fn)
     : fn{ fn }
   {
@@ -19,6 +28,7 @@ namespace jank::runtime::obj
   lazy_sequence::lazy_sequence(object_ptr const fn, object_ptr const sequence)
     : fn{ fn }
     , sequence{ sequence }
+    , state{ fn ? unrealized_state : realized_state }
   {
   }
 
@@ -113,17 +123,87 @@ namespace jank::runtime::obj
     return make_box<cons>(head, sequence ? this : nullptr);
   }
 
+  native_bool lazy_sequence::is_realized() const
+  {
+    if(state.load(std::memory_order_acquire) == realized_state)
+    {
+      return true;
+    }
+
+    auto const previous(claim());
+    if(previous == realized_state)
+    {
+      return true;
+    }
+
+    /* Like Clojure, we count as realized once fn has been called, even if the seq it
+     * returned hasn't been walked yet. */
+    native_bool const ret{ !fn };
+    release(previous, unrealized_state);
+    return ret;
+  }
+
+  uintptr_t lazy_sequence::claim() const
+  {
+    auto const self(thread_token());
+    auto current(state.load(std::memory_order_acquire));
+    while(true)
+    {
+      if(current == realized_state || current == self)
+      {
+        return current;
+      }
+      if(current == unrealized_state)
+      {
+        if(state.compare_exchange_weak(current, self, std::memory_order_acquire))
+        {
+          return unrealized_state;
+        }
+        continue;
+      }
+
+      state.wait(current, std::memory_order_acquire);
+      current = state.load(std::memory_order_acquire);
+    }
+  }
+
+  void lazy_sequence::release(uintptr_t const previous, uintptr_t const next) const
+  {
+    if(previous != unrealized_state)
+    {
+      return;
+    }
+    state.store(next, std::memory_order_release);
+    state.notify_all();
+  }
+
   object_ptr lazy_sequence::resolve_fn() const
   {
-    if(fn)
+    auto const previous(claim());
+    if(previous == realized_state)
     {
-      fn_result = dynamic_call(fn);
-      fn = nullptr;
-      if(fn_result == nil::nil_const())
+      return sequence;
+    }
+
+    try
+    {
+      if(fn)
       {
-        fn_result = nullptr;
+        fn_result = dynamic_call(fn);
+        fn = nullptr;
+        if(fn_result == nil::nil_const())
+        {
+          fn_result = nullptr;
+        }
       }
     }
+    catch(...)
+    {
+      release(previous, unrealized_state);
+      throw;
+    }
+    release(previous, unrealized_state);
+
     if(fn_result)
     {
       return fn_result;
@@ -133,24 +213,45 @@ namespace jank::runtime::obj
 
   object_ptr lazy_sequence::resolve_seq() const
   {
-    resolve_fn();
-    if(fn_result)
+    if(state.load(std::memory_order_acquire) == realized_state)
     {
-      object_ptr lazy{ fn_result };
-      fn_result = nullptr;
-      while(lazy && lazy->type == object_type::lazy_sequence)
-      {
-        lazy = expect_object<lazy_sequence>(lazy)->resolve_fn();
-      }
-      if(lazy)
+      return sequence;
+    }
+
+    auto const previous(claim());
+    if(previous == realized_state)
+    {
+      return sequence;
+    }
+
+    /* If fn throws, we're left unrealized and the next caller will try again. */
+    try
+    {
+      resolve_fn();
+      if(fn_result)
       {
-        sequence = runtime::seq(lazy);
-        if(sequence == nil::nil_const())
+        object_ptr lazy{ fn_result };
+        fn_result = nullptr;
+        while(lazy && lazy->type == object_type::lazy_sequence)
+        {
+          lazy = expect_object<lazy_sequence>(lazy)->resolve_fn();
+        }
+        if(lazy)
         {
-          sequence = nullptr;
+          sequence = runtime::seq(lazy);
+          if(sequence == nil::nil_const())
+          {
+            sequence = nullptr;
+          }
         }
       }
     }
+    catch(...)
+    {
+      release(previous, unrealized_state);
+      throw;
+    }
+    release(previous, realized_state);
     return sequence;
   }
 
@@ -4,6 +4,7 @@
 #include <jank/runtime/obj/persistent_hash_set.hpp>
 #include <jank/runtime/obj/persistent_vector_sequence.hpp>
 #include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/keyword.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/rtti.hpp>
 #include <jank/runtime/core.hpp>
@@ -11,6 +12,12 @@
 
 namespace jank::runtime::obj
 {
+  multi_function::cache::cache(object_ptr const hierarchy, persistent_hash_map_ptr const methods)
+    : hierarchy{ hierarchy }
+    , methods{ methods }
+  {
+  }
+
   multi_function::multi_function(object_ptr const name,
                                  object_ptr const dispatch,
                                  object_ptr const default_,
@@ -19,7 +26,7 @@ namespace jank::runtime::obj
     , default_dispatch_value{ default_ }
     , hierarchy{ hierarchy }
     , method_table{ persistent_hash_map::empty() }
-    , method_cache{ persistent_hash_map::empty() }
+    , method_cache{ new(GC) cache{ nullptr, persistent_hash_map::empty() } }
     , prefer_table{ persistent_hash_map::empty() }
     , name{ try_object<symbol>(name) }
   {
@@ -200,24 +207,27 @@ namespace jank::runtime::obj
 
   multi_function_ptr multi_function::reset()
   {
-    std::lock_guard<std::recursive_mutex> const locked{ data_lock };
-    cached_hierarchy = nullptr;
-    method_table = prefer_table = method_cache = persistent_hash_map::empty();
+    std::lock_guard<std::shared_mutex> const locked{ data_lock };
+    method_table = prefer_table = persistent_hash_map::empty();
+    publish_cache(nullptr, method_table);
     return this;
   }
 
-  persistent_hash_map_ptr multi_function::reset_cache()
+  void multi_function::reset_cache()
+  {
+    publish_cache(deref(hierarchy), method_table);
+  }
+
+  void multi_function::publish_cache(object_ptr const hierarchy,
+                                     persistent_hash_map_ptr const methods)
   {
-    std::lock_guard<std::recursive_mutex> const locked{ data_lock };
-    cached_hierarchy = hierarchy;
-    method_cache = method_table;
-    return method_cache;
+    method_cache.store(new(GC) cache{ hierarchy, methods }, std::memory_order_release);
   }
 
   multi_function_ptr
   multi_function::add_method(object_ptr const dispatch_val, object_ptr const method)
   {
-    std::lock_guard<std::recursive_mutex> const locked{ data_lock };
+    std::lock_guard<std::shared_mutex> const locked{ data_lock };
 
     method_table = method_table->assoc(dispatch_val, method);
     reset_cache();
@@ -226,7 +236,7 @@ namespace jank::runtime::obj
 
   multi_function_ptr multi_function::remove_method(object_ptr const dispatch_val)
   {
-    std::lock_guard<std::recursive_mutex> const locked{ data_lock };
+    std::lock_guard<std::shared_mutex> const locked{ data_lock };
     method_table = method_table->dissoc(dispatch_val);
     reset_cache();
     return this;
@@ -234,7 +244,7 @@ namespace jank::runtime::obj
 
   multi_function_ptr multi_function::prefer_method(object_ptr const x, object_ptr const y)
   {
-    std::lock_guard<std::recursive_mutex> const locked{ data_lock };
+    std::lock_guard<std::shared_mutex> const locked{ data_lock };
 
     if(is_preferred(deref(hierarchy), y, x))
     {
@@ -262,12 +272,10 @@ namespace jank::runtime::obj
       return true;
     }
 
-    static object_ptr const parents{
-      __rt_ctx->intern_var("clojure.core", "parents").expect_ok()->deref()
-    };
+    static object_ptr const parents{ __rt_ctx->intern_keyword("parents").expect_ok() };
+    auto const all_parents(get(hierarchy, parents));
 
-    for(auto it(fresh_seq(dynamic_call(parents, hierarchy, y))); it != nil::nil_const();
-        it = next_in_place(it))
+    for(auto it(fresh_seq(get(all_parents, y))); it != nil::nil_const(); it = next_in_place(it))
     {
       if(is_preferred(hierarchy, x, first(it)))
       {
@@ -275,8 +283,7 @@ namespace jank::runtime::obj
       }
     }
 
-    for(auto it(fresh_seq(dynamic_call(parents, hierarchy, x))); it != nil::nil_const();
-        it = next_in_place(it))
+    for(auto it(fresh_seq(get(all_parents, x))); it != nil::nil_const(); it = next_in_place(it))
     {
       if(is_preferred(hierarchy, first(it), y))
       {
@@ -290,10 +297,7 @@ namespace jank::runtime::obj
   native_bool
   multi_function::is_a(object_ptr const hierarchy, object_ptr const x, object_ptr const y)
   {
-    static object_ptr const isa{
-      __rt_ctx->intern_var("clojure.core", "isa?").expect_ok()->deref()
-    };
-    return truthy(dynamic_call(isa, deref(hierarchy), x, y));
+    return runtime::isa(hierarchy, x, y);
   }
 
   native_bool multi_function::is_dominant(object_ptr const hierarchy,
@@ -317,25 +321,54 @@ namespace jank::runtime::obj
 
   object_ptr multi_function::get_method(object_ptr const dispatch_val)
   {
-    if(cached_hierarchy != deref(hierarchy))
+    auto const cached(method_cache.load(std::memory_order_acquire));
+    if(cached->hierarchy == deref(hierarchy))
+    {
+      auto const target(cached->methods->get(dispatch_val));
+      if(target != nil::nil_const())
+      {
+        return target;
+      }
+    }
+
+    return find_and_cache_best_method(dispatch_val);
+  }
+
+  object_ptr multi_function::find_and_cache_best_method(object_ptr const dispatch_val)
+  {
+    persistent_hash_map_ptr table{};
+    object_ptr current_hierarchy{};
+    object_ptr best_value{};
+    {
+      std::shared_lock<std::shared_mutex> const locked{ data_lock };
+      table = method_table;
+      current_hierarchy = deref(hierarchy);
+      best_value = find_best_method(current_hierarchy, dispatch_val);
+    }
+
+    std::unique_lock<std::shared_mutex> locked{ data_lock };
+
+    /* Something changed between our locks, so what we found may no longer be right. */
+    if(table != method_table || current_hierarchy != deref(hierarchy))
     {
       reset_cache();
+      locked.unlock();
+      return find_and_cache_best_method(dispatch_val);
     }
 
-    auto const target(method_cache->get(dispatch_val));
-    if(target != nil::nil_const())
+    if(best_value != nil::nil_const())
     {
-      return target;
+      auto const cached(method_cache.load(std::memory_order_relaxed));
+      auto const methods(cached->hierarchy == current_hierarchy ? cached->methods : method_table);
+      publish_cache(current_hierarchy, methods->assoc(dispatch_val, best_value));
     }
 
-    return find_and_cache_best_method(dispatch_val);
+    return best_value;
   }
 
-  object_ptr multi_function::find_and_cache_best_method(object_ptr const dispatch_val)
+  object_ptr multi_function::find_best_method(object_ptr const hierarchy,
+                                              object_ptr const dispatch_val) const
   {
-    /* TODO: Clojure uses a RW lock here for better parallelism. */
-    std::lock_guard<std::recursive_mutex> const locked{ data_lock };
-    object_ptr best_value{ nil::nil_const() };
     persistent_vector_sequence_ptr best_entry{};
 
     for(auto it(method_table->fresh_seq()); it != nullptr; it = it->next_in_place())
@@ -343,14 +376,14 @@ namespace jank::runtime::obj
       auto const entry(it->first());
       auto const entry_key(entry->seq()->first());
 
-      if(is_a(cached_hierarchy, dispatch_val, entry_key))
+      if(is_a(hierarchy, dispatch_val, entry_key))
       {
-        if(best_entry == nullptr || is_dominant(cached_hierarchy, entry_key, best_entry->first()))
+        if(best_entry == nullptr || is_dominant(hierarchy, entry_key, best_entry->first()))
         {
           best_entry = entry->seq();
         }
 
-        if(!is_dominant(cached_hierarchy, best_entry->first(), entry_key))
+        if(!is_dominant(hierarchy, best_entry->first(), entry_key))
         {
           throw std::runtime_error{ fmt::format(
             "Multiple methods in multimethod '{}' match dispatch value: {} -> {} and {}, and "
@@ -365,19 +398,8 @@ namespace jank::runtime::obj
 
     if(best_entry)
     {
-      best_value = second(best_entry);
+      return second(best_entry);
     }
-    else
-    {
-      best_value = method_table->get(default_dispatch_value);
-      if(best_value == nil::nil_const())
-      {
-        return best_value;
-      }
-    }
-
-    method_cache = method_cache->assoc(dispatch_val, best_value);
-
-    return best_value;
+    return method_table->get(default_dispatch_value);
   }
 }
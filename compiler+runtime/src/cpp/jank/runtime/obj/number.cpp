@@ -1,3 +1,5 @@
+#include <utility>
+
 #include <fmt/format.h>
 
 #include <jank/native_persistent_string/fmt.hpp>
@@ -75,11 +77,17 @@ namespace jank::runtime::obj
   }
 
   /***** integer *****/
-  integer::integer(native_integer const d)
-    : data{ d }
+  template <size_t... I>
+  static constexpr std::array<integer, sizeof...(I)>
+  build_integer_cache(std::index_sequence<I...> const)
   {
+    return { integer{ integer::cache_min + static_cast<native_integer>(I) }... };
   }
 
+  constinit std::array<integer, integer::cache_max - integer::cache_min + 1> integer_cache{
+    build_integer_cache(std::make_index_sequence<integer::cache_max - integer::cache_min + 1>{})
+  };
+
   native_bool integer::equal(object const &o) const
   {
     if(o.type != object_type::integer)
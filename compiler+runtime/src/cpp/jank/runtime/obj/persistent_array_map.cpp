@@ -4,7 +4,7 @@
 #include <jank/runtime/obj/persistent_array_map.hpp>
 #include <jank/runtime/obj/persistent_hash_map.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
-#include <jank/runtime/obj/transient_hash_map.hpp>
+#include <jank/runtime/obj/transient_array_map.hpp>
 #include <jank/runtime/obj/nil.hpp>
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/to_string.hpp>
@@ -148,9 +148,8 @@ namespace jank::runtime::obj
     return found;
   }
 
-  transient_hash_map_ptr persistent_array_map::to_transient() const
+  transient_array_map_ptr persistent_array_map::to_transient() const
   {
-    /* TODO: Use a transient_array_map. */
-    return make_box<transient_hash_map>(data);
+    return make_box<transient_array_map>(data);
   }
 }
@@ -1,6 +1,7 @@
 #include <jank/runtime/obj/persistent_sorted_set.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 
 namespace jank::runtime::obj
 {
@@ -113,6 +114,11 @@ namespace jank::runtime::obj
     return data.size();
   }
 
+  object_ptr persistent_sorted_set::reduce(object_ptr const f, object_ptr const init) const
+  {
+    return behavior::detail::reduce(f, init, data.begin(), data.end());
+  }
+
   persistent_sorted_set_ptr persistent_sorted_set::with_meta(object_ptr const m) const
   {
     auto const meta(behavior::detail::validate_meta(m));
@@ -76,7 +76,7 @@ namespace jank::runtime::obj
       {
         return fallback;
       }
-      return make_box<character>(data[i]);
+      return make_box(data[i]);
     }
     else
     {
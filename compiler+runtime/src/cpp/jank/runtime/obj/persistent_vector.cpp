@@ -1,5 +1,7 @@
 #include <fmt/format.h>
 
+#include <immer/algorithm.hpp>
+
 #include <jank/native_persistent_string/fmt.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/transient_vector.hpp>
@@ -7,6 +9,7 @@
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/seq_ext.hpp>
 #include <jank/runtime/behavior/sequential.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 
 namespace jank::runtime::obj
 {
@@ -195,6 +198,42 @@ namespace jank::runtime::obj
     return data.size();
   }
 
+  /* behavior::reducible */
+  object_ptr persistent_vector::reduce(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    /* Going leaf by leaf keeps the inner loop to a plain array walk. */
+    immer::for_each_chunk_p(data, [&](object_ptr const *it, object_ptr const * const end) {
+      for(; it != end; ++it)
+      {
+        if(behavior::detail::reduce_step(f, acc, *it))
+        {
+          return false;
+        }
+      }
+      return true;
+    });
+    return acc;
+  }
+
+  /* behavior::kv_reducible */
+  object_ptr persistent_vector::reduce_kv(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    size_t i{};
+    immer::for_each_chunk_p(data, [&](object_ptr const *it, object_ptr const * const end) {
+      for(; it != end; ++it, ++i)
+      {
+        if(behavior::detail::reduce_kv_step(f, acc, make_box(i), *it))
+        {
+          return false;
+        }
+      }
+      return true;
+    });
+    return acc;
+  }
+
   persistent_vector_ptr persistent_vector::conj(object_ptr head) const
   {
     auto vec(data.push_back(head));
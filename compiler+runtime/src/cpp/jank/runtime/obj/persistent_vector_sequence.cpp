@@ -1,7 +1,11 @@
+#include <immer/algorithm.hpp>
+
 #include <jank/runtime/obj/persistent_vector_sequence.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/array_chunk.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/core/seq_ext.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 
 namespace jank::runtime::obj
 {
@@ -76,6 +80,26 @@ namespace jank::runtime::obj
     return vec->data.size() - index;
   }
 
+  /* behavior::reducible */
+  object_ptr persistent_vector_sequence::reduce(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    immer::for_each_chunk_p(
+      vec->data.begin() + static_cast<decltype(persistent_vector::data)::difference_type>(index),
+      vec->data.end(),
+      [&](object_ptr const *it, object_ptr const * const end) {
+        for(; it != end; ++it)
+        {
+          if(behavior::detail::reduce_step(f, acc, *it))
+          {
+            return false;
+          }
+        }
+        return true;
+      });
+    return acc;
+  }
+
   /* behavior::seqable */
   persistent_vector_sequence_ptr persistent_vector_sequence::seq()
   {
@@ -118,6 +142,43 @@ namespace jank::runtime::obj
     return this;
   }
 
+  /* The leaf, or the rest of it, which holds our first element. */
+  static std::pair<object_ptr const *, object_ptr const *>
+  leaf_at(persistent_vector_ptr const vec, size_t const index)
+  {
+    std::pair<object_ptr const *, object_ptr const *> ret;
+    immer::for_each_chunk_p(
+      vec->data.begin() + static_cast<decltype(persistent_vector::data)::difference_type>(index),
+      vec->data.end(),
+      [&](object_ptr const * const first, object_ptr const * const last) {
+        ret = { first, last };
+        return false;
+      });
+    return ret;
+  }
+
+  /* behavior::chunkable */
+  array_chunk_ptr persistent_vector_sequence::chunked_first() const
+  {
+    auto const leaf(leaf_at(vec, index));
+    return make_box<array_chunk>(leaf.first,
+                                 static_cast<size_t>(leaf.second - leaf.first),
+                                 static_cast<size_t>(0));
+  }
+
+  persistent_vector_sequence_ptr persistent_vector_sequence::chunked_next() const
+  {
+    auto const leaf(leaf_at(vec, index));
+    auto const n(index + static_cast<size_t>(leaf.second - leaf.first));
+
+    if(n == vec->data.size())
+    {
+      return nullptr;
+    }
+
+    return make_box<persistent_vector_sequence>(vec, n);
+  }
+
   cons_ptr persistent_vector_sequence::conj(object_ptr const head)
   {
     return make_box<cons>(head, this);
@@ -0,0 +1,78 @@
+#include <fmt/format.h>
+
+#include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/executor.hpp>
+
+namespace jank::runtime::obj
+{
+  native_bool promise::equal(object const &o) const
+  {
+    return &o == &base;
+  }
+
+  native_persistent_string promise::to_string() const
+  {
+    util::string_builder buff;
+    to_string(buff);
+    return buff.release();
+  }
+
+  void promise::to_string(util::string_builder &buff) const
+  {
+    fmt::format_to(std::back_inserter(buff), "{}@{}", object_type_str(base.type), fmt::ptr(&base));
+  }
+
+  native_persistent_string promise::to_code_string() const
+  {
+    return to_string();
+  }
+
+  native_hash promise::to_hash() const
+  {
+    return static_cast<native_hash>(reinterpret_cast<uintptr_t>(this));
+  }
+
+  object_ptr promise::deref()
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    /* Whatever delivers this may still be queued on the executor we're running on. */
+    executor::wait(lock, delivery, [this] { return delivered; });
+    return val;
+  }
+
+  object_ptr promise::deref(object_ptr const timeout_ms, object_ptr const timeout_val)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    if(!executor::wait_for(lock,
+                           delivery,
+                           std::chrono::milliseconds{ to_int(timeout_ms) },
+                           [this] { return delivered; }))
+    {
+      return timeout_val;
+    }
+    return val;
+  }
+
+  native_bool promise::is_realized()
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    return delivered;
+  }
+
+  native_bool promise::deliver(object_ptr const o)
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(delivered)
+      {
+        return false;
+      }
+      val = o;
+      delivered = true;
+    }
+    delivery.notify_all();
+    executor::notify_helpers();
+    return true;
+  }
+}
@@ -37,7 +37,7 @@ namespace jank::runtime::obj
     ratio_data const data{ numerator, denominator };
     if(data.denominator == 1)
     {
-      return make_box<integer>(data.numerator);
+      return integer::create(data.numerator);
     }
     return make_box<ratio>(data);
   }
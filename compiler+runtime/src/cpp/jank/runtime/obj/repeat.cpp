@@ -3,6 +3,7 @@
 #include <jank/runtime/core/math.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 
 namespace jank::runtime::obj
 {
@@ -83,6 +84,28 @@ namespace jank::runtime::obj
     return this;
   }
 
+  object_ptr repeat::reduce(object_ptr const f, object_ptr const init) const
+  {
+    object_ptr acc{ init };
+    if(runtime::equal(count, make_box(infinite)))
+    {
+      while(!behavior::detail::reduce_step(f, acc, value))
+      {
+      }
+      return acc;
+    }
+
+    auto const n(to_int(count));
+    for(native_integer i{}; i < n; ++i)
+    {
+      if(behavior::detail::reduce_step(f, acc, value))
+      {
+        break;
+      }
+    }
+    return acc;
+  }
+
   cons_ptr repeat::conj(object_ptr const head) const
   {
     return make_box<cons>(head, this);
@@ -6,6 +6,7 @@
 #include <jank/runtime/behavior/callable.hpp>
 #include <jank/runtime/rtti.hpp>
 #include <jank/runtime/context.hpp>
+#include <jank/jit/background_compiler.hpp>
 #include <jank/runtime/core/to_string.hpp>
 #include <jank/runtime/obj/persistent_hash_map.hpp>
 #include <jank/profile/time.hpp>
@@ -23,7 +24,7 @@ namespace jank::runtime
   var::var(ns_ptr const &n, obj::symbol_ptr const &name, object_ptr const root)
     : n{ n }
     , name{ name }
-    , root{ root }
+    , root{ root.data }
   {
   }
 
@@ -34,7 +35,7 @@ namespace jank::runtime
            native_bool const thread_bound)
     : n{ n }
     , name{ name }
-    , root{ root }
+    , root{ root.data }
     , dynamic{ dynamic }
     , thread_bound{ thread_bound }
   {
@@ -101,22 +102,79 @@ namespace jank::runtime
 
   object_ptr var::get_root() const
   {
-    profile::timer const timer{ "var get_root" };
-    return *root.rlock();
+    object_ptr const r{ root.load(std::memory_order_acquire) };
+    if(!r) [[unlikely]]
+    {
+      return wait_for_root();
+    }
+    return r;
+  }
+
+  object_ptr var::wait_for_root() const
+  {
+    profile::timer const timer{ "var wait_for_root" };
+    /* If the background JIT is compiling our fn, it's up to us to finish it. */
+    if(__rt_ctx->background_jit)
+    {
+      __rt_ctx->background_jit->finish(*this);
+    }
+    root.wait(nullptr, std::memory_order_acquire);
+    return root.load(std::memory_order_acquire);
   }
 
   var_ptr var::bind_root(object_ptr const r)
   {
     profile::timer const timer{ "var bind_root" };
-    *root.wlock() = r;
+    std::lock_guard<std::recursive_mutex> const lock{ root_mutex };
+    ++pending_generation;
+    if(!root.exchange(r.data, std::memory_order_acq_rel))
+    {
+      root.notify_all();
+    }
     return this;
   }
 
   object_ptr var::alter_root(object_ptr const f, object_ptr const args)
   {
-    auto locked_root(root.wlock());
-    *locked_root = apply_to(f, cons(*locked_root, args));
-    return *locked_root;
+    std::unique_lock<std::recursive_mutex> lock{ root_mutex };
+    /* A pending root is bound while holding the lock, so we can't wait for it here. It can
+     * become pending again before we retake the lock, so we check until it isn't. */
+    while(!root.load(std::memory_order_acquire))
+    {
+      lock.unlock();
+      get_root();
+      lock.lock();
+    }
+
+    ++pending_generation;
+    object_ptr const altered{ apply_to(f, cons(root.load(std::memory_order_acquire), args)) };
+    root.store(altered.data, std::memory_order_release);
+    return altered;
+  }
+
+  size_t var::set_pending_root()
+  {
+    std::lock_guard<std::recursive_mutex> const lock{ root_mutex };
+    root.store(nullptr, std::memory_order_release);
+    return ++pending_generation;
+  }
+
+  native_bool var::is_pending_root() const
+  {
+    return root.load(std::memory_order_acquire) == nullptr;
+  }
+
+  native_bool var::bind_pending_root(object_ptr const r, size_t const generation)
+  {
+    std::lock_guard<std::recursive_mutex> const lock{ root_mutex };
+    if(generation != pending_generation)
+    {
+      return false;
+    }
+
+    root.store(r.data, std::memory_order_release);
+    root.notify_all();
+    return true;
   }
 
   string_result<void> var::set(object_ptr const r) const
@@ -146,7 +204,7 @@ namespace jank::runtime
 
   var_thread_binding_ptr var::get_thread_binding() const
   {
-    if(!thread_bound.load())
+    if(!thread_bound.load(std::memory_order_acquire))
     {
       return nullptr;
     }
@@ -172,13 +230,17 @@ namespace jank::runtime
 
   object_ptr var::deref() const
   {
-    auto const binding(get_thread_binding());
-    if(binding)
+    /* Most vars are never bound, so we don't want to pay for the binding lookup. */
+    if(thread_bound.load(std::memory_order_acquire))
     {
-      assert(binding->value);
-      return binding->value;
+      auto const binding(get_thread_binding());
+      if(binding)
+      {
+        assert(binding->value);
+        return binding->value;
+      }
     }
-    return *root.rlock();
+    return get_root();
   }
 
   var_ptr var::clone() const
@@ -25,9 +25,53 @@ namespace jank::util::cli
     cli.add_option("--profile-output",
                    opts.profiler_file,
                    "The file to write profile entries (will be overwritten).");
+    cli
+      .add_option("--profile-format",
+                  opts.profiler_format,
+                  "The format of the profile output. The chrome format can be loaded into "
+                  "Perfetto or chrome://tracing.")
+      ->check(CLI::IsMember({ "binary", "chrome" }));
     cli.add_flag("--gc-incremental", opts.gc_incremental, "Enable incremental GC collection.");
+    cli
+      .add_option("--gc-markers",
+                  opts.gc_markers,
+                  "The number of threads used to mark during GC collections. With 0, there's "
+                  "one per core.")
+      ->check(CLI::NonNegativeNumber);
+    cli
+      .add_option("--gc-initial-heap",
+                  opts.gc_initial_heap,
+                  "The size to grow the GC heap to on start, such as 512MB, to avoid "
+                  "collecting while it grows.")
+      ->transform(CLI::AsSizeValue{ false });
+    cli
+      .add_option("--gc-max-heap",
+                  opts.gc_max_heap,
+                  "The size past which the GC heap won't grow. With 0, it's unbounded.")
+      ->transform(CLI::AsSizeValue{ false });
+    cli
+      .add_option("--gc-free-space-divisor",
+                  opts.gc_free_space_divisor,
+                  "Higher values collect more often, with a smaller heap. The GC's default is "
+                  "3.")
+      ->check(CLI::PositiveNumber);
+    cli
+      .add_option("--executor-threads",
+                  opts.executor_threads,
+                  "The number of threads used to run futures, pmap, and the like. With 0, "
+                  "there's one per core.")
+      ->check(CLI::NonNegativeNumber);
+    cli.add_flag("--compile-cache",
+                 opts.compile_cache,
+                 "Cache compiled modules in the user cache dir, keyed by their source, and reuse "
+                 "them when loading the same source again.");
     cli.add_option("-O,--optimization", opts.optimization_level, "The optimization level to use.")
       ->check(CLI::Range(0, 3));
+    cli.add_option("--jit-threads",
+                   opts.jit_threads,
+                   "The number of threads used to compile fn definitions in the background. "
+                   "With 0, they're compiled as they're evaluated.")
+      ->check(CLI::NonNegativeNumber);
 
     /* Native dependencies. */
     cli.add_option("-I,--include-dir",
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <charconv>
+#include <chrono>
+
+#include <gc/gc.h>
+
+#include <jank/util/gc_config.hpp>
+
+namespace jank::util
+{
+  /* These are updated from the collection event hook, which may run on any thread. */
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<uint64_t> collection_start_ns;
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<uint64_t> total_pause_ns;
+  /* NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) */
+  static std::atomic<uint64_t> max_pause_ns;
+
+  static uint64_t now_ns()
+  {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+  }
+
+  /* The set of events differs between GC versions, so we only pick out the two we need,
+   * rather than switching over all of them. */
+  static void on_collection_event(GC_EventType const event)
+  {
+    if(event == GC_EVENT_START)
+    {
+      collection_start_ns = now_ns();
+    }
+    else if(event == GC_EVENT_END)
+    {
+      auto const pause(now_ns() - collection_start_ns);
+      total_pause_ns += pause;
+      auto max(max_pause_ns.load());
+      while(max < pause && !max_pause_ns.compare_exchange_weak(max, pause))
+      {
+      }
+    }
+  }
+
+  void configure_gc_markers(int const argc, char const **argv)
+  {
+    static constexpr native_persistent_string_view flag{ "--gc-markers" };
+
+    for(int i{ 1 }; i < argc; ++i)
+    {
+      native_persistent_string_view const arg{ argv[i] };
+      native_persistent_string_view value;
+      if(arg == flag && i + 1 < argc)
+      {
+        value = argv[i + 1];
+      }
+      else if(arg.starts_with(flag) && arg.size() > flag.size() && arg[flag.size()] == '=')
+      {
+        value = arg.substr(flag.size() + 1);
+      }
+      else
+      {
+        continue;
+      }
+
+      unsigned markers{};
+      auto const res(std::from_chars(value.data(), value.data() + value.size(), markers));
+      /* 0 leaves it up to the GC, which uses one per core. */
+      if(res.ec == std::errc{} && res.ptr == value.data() + value.size() && markers != 0)
+      {
+        GC_set_markers_count(markers);
+      }
+      return;
+    }
+  }
+
+  void configure_gc(cli::options const &opts)
+  {
+    GC_set_on_collection_event(&on_collection_event);
+
+    if(opts.gc_incremental)
+    {
+      GC_enable_incremental();
+    }
+    if(opts.gc_initial_heap != 0)
+    {
+      GC_expand_hp(static_cast<size_t>(opts.gc_initial_heap));
+    }
+    if(opts.gc_max_heap != 0)
+    {
+      GC_set_max_heap_size(static_cast<GC_word>(opts.gc_max_heap));
+    }
+    if(opts.gc_free_space_divisor != 0)
+    {
+      GC_set_free_space_divisor(static_cast<GC_word>(opts.gc_free_space_divisor));
+    }
+  }
+
+  gc_stats get_gc_stats()
+  {
+    gc_stats ret;
+    GC_word heap{}, free{}, unmapped{}, since_collection{}, total{};
+    GC_get_heap_usage_safe(&heap, &free, &unmapped, &since_collection, &total);
+
+    ret.collections = static_cast<size_t>(GC_get_gc_no());
+    ret.total_pause_ns = total_pause_ns;
+    ret.max_pause_ns = max_pause_ns;
+    ret.heap_bytes = heap;
+    ret.free_bytes = free;
+    ret.unmapped_bytes = unmapped;
+    ret.bytes_since_collection = since_collection;
+    ret.bytes_allocated = total;
+    ret.markers = static_cast<size_t>(GC_get_parallel()) + 1;
+    ret.incremental = GC_is_incremental_mode() != 0;
+    return ret;
+  }
+}
@@ -0,0 +1,18 @@
+#include <gc/gc.h>
+
+#include <jank/util/gc_thread.hpp>
+
+namespace jank::util
+{
+  gc_thread_scope::gc_thread_scope()
+  {
+    GC_stack_base stack_base{};
+    GC_get_stack_base(&stack_base);
+    GC_register_my_thread(&stack_base);
+  }
+
+  gc_thread_scope::~gc_thread_scope()
+  {
+    GC_unregister_my_thread();
+  }
+}
@@ -2,6 +2,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/filesystem.hpp>
@@ -40,6 +41,30 @@ namespace jank::util
     }
   }
 
+  void mapped_file::advise_sequential() const
+  {
+    if(head != nullptr)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    {
+      madvise(reinterpret_cast<void *>(const_cast<char *>(head)), size, MADV_SEQUENTIAL);
+    }
+  }
+
+  void mapped_file::release(size_t const offset, size_t const length) const
+  {
+    /* madvise needs page aligned ranges, so we only release the whole pages in this range. */
+    static auto const page_size(static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+    auto const start((offset + page_size - 1) / page_size * page_size);
+    auto const end(std::min(offset + length, size) / page_size * page_size);
+    if(head == nullptr || end <= start)
+    {
+      return;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    madvise(reinterpret_cast<void *>(const_cast<char *>(head + start)), end - start, MADV_DONTNEED);
+  }
+
   result<mapped_file, native_persistent_string> map_file(native_transient_string const &path)
   {
     if(!boost::filesystem::exists(path.data()))
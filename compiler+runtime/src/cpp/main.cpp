@@ -26,10 +26,13 @@
 #include <jank/profile/time.hpp>
 #include <jank/error/report.hpp>
 #include <jank/util/scope_exit.hpp>
+#include <jank/util/gc_config.hpp>
 
 #include <jank/compiler_native.hpp>
 #include <jank/perf_native.hpp>
+#include <jank/gc_native.hpp>
 #include <clojure/core_native.hpp>
+#include <clojure/edn_native.hpp>
 
 namespace jank
 {
@@ -286,6 +289,7 @@ try
   /* The GC needs to enabled even before arg parsing, since our native types,
    * like strings, use the GC for allocations. It can still be configured later. */
   GC_set_all_interior_pointers(1);
+  util::configure_gc_markers(argc, argv);
   GC_enable();
 
   llvm::llvm_shutdown_obj const Y{};
@@ -301,19 +305,22 @@ try
   }
   auto const &opts(parse_result.expect_ok());
 
-  if(opts.gc_incremental)
-  {
-    GC_enable_incremental();
-  }
+  util::configure_gc(opts);
+  GC_allow_register_threads();
 
   profile::configure(opts);
+  /* This is declared first so that it runs after main's own region has been exited. */
+  util::scope_exit const finish_profile{ &profile::shutdown };
   profile::timer const timer{ "main" };
 
   __rt_ctx = new(GC) runtime::context{ opts };
+  util::scope_exit const finish_executor{ [] { __rt_ctx->shutdown_executor(); } };
 
   jank_load_clojure_core_native();
+  jank_load_clojure_edn_native();
   jank_load_jank_compiler_native();
   jank_load_jank_perf_native();
+  jank_load_jank_gc_native();
 
   switch(opts.command)
   {
@@ -0,0 +1,97 @@
+#include <random>
+
+#include <jank/hash.hpp>
+#include <jank/native_persistent_string.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::hash
+{
+  /* These are the straightforward, char at a time, versions of our string hashes. The
+   * optimized versions need to match them exactly, since hashes are observable. */
+  static uint32_t reference_string(native_persistent_string_view const &input)
+  {
+    auto const length(input.size());
+    uint32_t h1{};
+
+    for(size_t i{ 1 }; i < length; i += 2)
+    {
+      auto k1(static_cast<uint32_t>(input[i - 1] | (input[i] << 16)));
+      k1 = mix_k1(k1);
+      h1 = mix_h1(h1, k1);
+    }
+
+    if((length & 1) == 1)
+    {
+      auto k1(static_cast<uint32_t>(static_cast<uint8_t>(input[length - 1])));
+      k1 = mix_k1(k1);
+      h1 ^= k1;
+    }
+
+    return fmix(h1, 2 * length);
+  }
+
+  static native_hash reference_to_hash(native_persistent_string_view const &input)
+  {
+    native_hash h{};
+    for(auto const c : input)
+    {
+      h = 31 * h + (c & 0xff);
+    }
+    return integer(h);
+  }
+
+  static native_persistent_string make_string(size_t const length, native_bool const ascii)
+  {
+    static std::mt19937 gen{ 0 };
+    std::uniform_int_distribution<int> dist{ ascii ? 32 : -128, ascii ? 126 : 127 };
+    native_transient_string ret(length, ' ');
+    for(auto &c : ret)
+    {
+      c = static_cast<char>(dist(gen));
+    }
+    return ret;
+  }
+
+  TEST_SUITE("hash")
+  {
+    TEST_CASE("String")
+    {
+      for(size_t length{}; length < 100; ++length)
+      {
+        for(auto const ascii : { true, false })
+        {
+          CAPTURE(length);
+          CAPTURE(ascii);
+          auto const s(make_string(length, ascii));
+          CHECK(string(s) == reference_string(s));
+          CHECK(s.to_hash() == reference_to_hash(s));
+        }
+      }
+    }
+
+    TEST_CASE("Known values")
+    {
+      /* Symbol and keyword hashes are built from these, so they shouldn't change. */
+      CHECK(string("") == 0);
+      CHECK(string("a") == 0x6f49d11a);
+      CHECK(string("foo") == 0x7c4f6755);
+    }
+
+    TEST_CASE("Cached persistent_string")
+    {
+      auto const s(make_string(1024, true));
+      auto const o(make_box<runtime::obj::persistent_string>(s));
+      auto const expected(reference_to_hash(s));
+      CHECK(o->to_hash() == expected);
+      CHECK(o->to_hash() == expected);
+
+      /* Copies of a large string share its storage, and its hash. */
+      runtime::obj::persistent_string const copy{ o->data };
+      CHECK(copy.to_hash() == expected);
+    }
+  }
+}
@@ -0,0 +1,132 @@
+#include <fstream>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+
+#include <fmt/format.h>
+
+#include <jank/jit/background_compiler.hpp>
+#include <jank/jit/processor.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/module/loader.hpp>
+#include <jank/util/gc_thread.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::jit
+{
+  using runtime::__rt_ctx;
+
+  /* The test runtime is started without --jit-threads, so each test gets its own background
+   * JIT. Anything left pending is finished before it goes away, since nothing else could
+   * finish it afterward. */
+  struct background_jit_scope
+  {
+    background_jit_scope()
+    {
+      __rt_ctx->background_jit = std::make_unique<background_compiler>(__rt_ctx->jit_prc, 2);
+    }
+
+    ~background_jit_scope()
+    {
+      CHECK(__rt_ctx->background_jit->join(0).is_ok());
+      __rt_ctx->background_jit.reset();
+    }
+  };
+
+  static runtime::var_ptr find_var(native_persistent_string const &name)
+  {
+    return runtime::expect_object<runtime::var>(
+      __rt_ctx->eval_string(fmt::format("(var {})", name)));
+  }
+
+  TEST_SUITE("background jit")
+  {
+    TEST_CASE("a fn is built by whoever needs it")
+    {
+      background_jit_scope const jit;
+      __rt_ctx->eval_string("(defn background-jit-deref [] :done)");
+
+      /* The workers only compile it, so it stays pending until it's dereferenced. */
+      auto const v(find_var("background-jit-deref"));
+      CHECK(v->is_pending_root());
+
+      native_vector<runtime::object_ptr> results(4);
+      native_vector<std::thread> threads;
+      for(size_t i{}; i < results.size(); ++i)
+      {
+        threads.emplace_back([&, i] {
+          util::gc_thread_scope const gc_thread;
+          results[i] = runtime::dynamic_call(v->deref());
+        });
+      }
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+
+      CHECK(!v->is_pending_root());
+      for(auto const &res : results)
+      {
+        CHECK(runtime::equal(res, __rt_ctx->intern_keyword("done").expect_ok()));
+      }
+    }
+
+    TEST_CASE("redefining a fn")
+    {
+      background_jit_scope const jit;
+
+      /* The first definition can finish compiling after the second, but the second must
+       * always win. */
+      for(native_integer i{}; i < 20; ++i)
+      {
+        __rt_ctx->eval_string(fmt::format(R"((defn background-jit-redef [] {})
+                                             (defn background-jit-redef [] {}))",
+                                          i,
+                                          i + 1));
+        CHECK(runtime::equal(__rt_ctx->eval_string("(background-jit-redef)"),
+                             runtime::make_box(i + 1)));
+      }
+
+      SUBCASE("A plain def supersedes a pending fn")
+      {
+        __rt_ctx->eval_string(R"((defn background-jit-redef [] :fn)
+                                 (def background-jit-redef :value))");
+        CHECK(__rt_ctx->background_jit->join(0).is_ok());
+        CHECK(runtime::equal(__rt_ctx->eval_string("background-jit-redef"),
+                             __rt_ctx->intern_keyword("value").expect_ok()));
+      }
+    }
+
+    TEST_CASE("loading a module")
+    {
+      background_jit_scope const jit;
+      auto const dir(boost::filesystem::temp_directory_path()
+                     / boost::filesystem::unique_path("jank-background-jit-%%%%-%%%%"));
+      boost::filesystem::create_directories(dir);
+      std::ofstream{ (dir / "background_jit_module.jank").string() }
+        << R"((ns background-jit-module)
+              (defn one [] 1)
+              (defn two [] (+ (one) 1))
+              (def value (two))
+              (defn unused [] 3))";
+      __rt_ctx->module_loader.add_path(dir.string());
+
+      /* Vars which the module needs are built while it loads and the rest are built once
+       * it's done, so none are left pending. */
+      CHECK(__rt_ctx->load_module("/background-jit-module", runtime::module::origin::latest)
+              .is_ok());
+      CHECK(!find_var("background-jit-module/unused")->is_pending_root());
+      CHECK(runtime::equal(find_var("background-jit-module/value")->deref(),
+                           runtime::make_box(2)));
+      CHECK(runtime::equal(__rt_ctx->eval_string("(background-jit-module/unused)"),
+                           runtime::make_box(3)));
+
+      boost::system::error_code ec;
+      boost::filesystem::remove_all(dir, ec);
+    }
+  }
+}
@@ -0,0 +1,92 @@
+#include <sstream>
+
+#include <jank/profile/time.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::profile
+{
+  /* Builds a binary trace by hand, the same way the profiler writes it. */
+  struct trace_builder
+  {
+    trace_builder()
+    {
+      out.write(trace_magic.data(), static_cast<std::streamsize>(trace_magic.size()));
+      out.write(reinterpret_cast<char const *>(&trace_version), sizeof(trace_version));
+    }
+
+    trace_builder &label(label_id const id, native_persistent_string_view const &name)
+    {
+      record const r{ name.size(), id, 0, record_kind::label };
+      out.write(reinterpret_cast<char const *>(&r), sizeof(r));
+      out.write(name.data(), static_cast<std::streamsize>(name.size()));
+      return *this;
+    }
+
+    trace_builder &
+    event(record_kind const kind, label_id const id, uint64_t const time, uint16_t const thread)
+    {
+      record const r{ time, id, thread, kind };
+      out.write(reinterpret_cast<char const *>(&r), sizeof(r));
+      return *this;
+    }
+
+    std::stringstream out;
+  };
+
+  TEST_SUITE("profile")
+  {
+    TEST_CASE("chrome trace")
+    {
+      trace_builder t;
+      t.label(1, "outer")
+        .label(2, "in\"ner")
+        .event(record_kind::enter, 1, 1000, 0)
+        .event(record_kind::enter, 2, 2000, 1)
+        .event(record_kind::exit, 2, 5000, 1)
+        .event(record_kind::exit, 1, 11000, 0);
+
+      std::stringstream out;
+      REQUIRE(write_chrome_trace(t.out, out).is_ok());
+      auto const json(out.str());
+      CHECK(json.find(R"({"name":"outer","ph":"X","ts":0.000,"dur":10.000,"pid":1,"tid":0})")
+            != std::string::npos);
+      CHECK(json.find(R"({"name":"in\"ner","ph":"X","ts":1.000,"dur":3.000,"pid":1,"tid":1})")
+            != std::string::npos);
+    }
+
+    TEST_CASE("summary")
+    {
+      trace_builder t;
+      t.label(1, "outer")
+        .label(2, "inner")
+        .label(3, "thrown")
+        .event(record_kind::enter, 1, 0, 0)
+        .event(record_kind::enter, 2, 1000000, 0)
+        .event(record_kind::enter, 2, 2000000, 0)
+        .event(record_kind::exit, 2, 3000000, 0)
+        .event(record_kind::exit, 2, 4000000, 0)
+        /* Exceptions can skip exits, so this region is closed along with its parent. */
+        .event(record_kind::enter, 3, 5000000, 0)
+        /* This exit has no enter, so it's dropped. */
+        .event(record_kind::exit, 2, 6000000, 0)
+        .event(record_kind::exit, 1, 10000000, 0);
+
+      std::stringstream out;
+      REQUIRE(write_summary(t.out, out).is_ok());
+      auto const summary(out.str());
+      CHECK(summary.find("         5.000          5.000          1  thrown") != std::string::npos);
+      CHECK(summary.find("        10.000          2.000          1  outer") != std::string::npos);
+      /* Recursion doesn't count toward inclusive time twice. */
+      CHECK(summary.find("         3.000          3.000          2  inner") != std::string::npos);
+    }
+
+    TEST_CASE("invalid trace")
+    {
+      std::stringstream in{ "not a trace" };
+      std::stringstream out;
+      CHECK(write_summary(in, out).is_err());
+    }
+  }
+}
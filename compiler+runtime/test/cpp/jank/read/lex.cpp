@@ -2117,5 +2117,114 @@ namespace jank::read::lex
               }));
       }
     }
+
+    TEST_CASE("Long runs")
+    {
+      /* These are long enough to cross several vector blocks, with the interesting
+       * character at every possible position within a block. */
+      for(size_t length{ 1 }; length < 80; ++length)
+      {
+        CAPTURE(length);
+        native_transient_string const name(length, 'a');
+
+        {
+          auto const symbol(name + " ");
+          processor p{ symbol };
+          native_vector<result<token, error_ptr>> const tokens(p.begin(), p.end());
+          CHECK(tokens
+                == make_tokens({
+                  { 0, length, token_kind::symbol, native_persistent_string_view{ name } }
+          }));
+        }
+
+        {
+          auto const keyword(":" + name + "]");
+          processor p{ keyword };
+          native_vector<result<token, error_ptr>> const tokens(p.begin(), p.end());
+          CHECK(tokens
+                == make_tokens({
+                  { 0, length + 1, token_kind::keyword, native_persistent_string_view{ name } },
+                  { length + 1, 1, token_kind::close_square_bracket }
+          }));
+        }
+
+        {
+          auto const string("\"" + name + "\"");
+          processor p{ string };
+          native_vector<result<token, error_ptr>> const tokens(p.begin(), p.end());
+          CHECK(tokens
+                == make_tokens({
+                  { 0, length + 2, token_kind::string, native_persistent_string_view{ name } }
+          }));
+        }
+
+        {
+          auto const space(native_transient_string(length, ',') + "a");
+          processor p{ space };
+          native_vector<result<token, error_ptr>> const tokens(p.begin(), p.end());
+          CHECK(tokens
+                == make_tokens({
+                  { length, 1, token_kind::symbol, "a"sv }
+          }));
+        }
+      }
+
+      SUBCASE("Non-ASCII within a symbol")
+      {
+        native_transient_string const name{ "abcdefghijklmnopqrstuvwxyz"
+                                            "ありがとう"
+                                            "abcdefghijklmnop" };
+        processor p{ name };
+        native_vector<result<token, error_ptr>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                { 0, name.size(), token_kind::symbol, native_persistent_string_view{ name } }
+        }));
+      }
+
+      SUBCASE("Escapes within a string")
+      {
+        native_persistent_string_view const body{
+          R"(abcdefghijklmnopqrstuvwxyz\"abcdefghijklmnopqrstuvwxyz\\abcdefghijklmnop)"
+        };
+        native_transient_string const string{ "\"" + native_transient_string{ body } + "\"" };
+        processor p{ string };
+        native_vector<result<token, error_ptr>> const tokens(p.begin(), p.end());
+        CHECK(tokens
+              == make_tokens({
+                { 0, string.size(), token_kind::escaped_string, body }
+        }));
+      }
+    }
+
+    TEST_CASE("Line tracking")
+    {
+      native_transient_string code;
+      for(size_t i{}; i < 40; ++i)
+      {
+        code += "  \n";
+      }
+      code += "  \"a\nbb\nccc\" d";
+
+      processor p{ code };
+      auto const string(p.next().expect_ok());
+      CHECK(string.start == source_position{ 122, 41, 3 });
+      CHECK(string.end == source_position{ 132, 43, 5 });
+      auto const symbol(p.next().expect_ok());
+      CHECK(symbol.start == source_position{ 133, 43, 6 });
+
+      SUBCASE("Matches stepping one byte at a time")
+      {
+        movable_position stepped{ .proc = &p };
+        for(size_t i{}; i < code.size(); ++i)
+        {
+          movable_position jumped{ .proc = &p };
+          jumped += i;
+          CHECK(jumped.line == stepped.line);
+          CHECK(jumped.col == stepped.col);
+          ++stepped;
+        }
+      }
+    }
   }
 }
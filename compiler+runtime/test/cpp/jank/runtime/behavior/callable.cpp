@@ -130,5 +130,26 @@ namespace jank::runtime
                                                           make_box('q'))),
                   make_box<obj::persistent_string>("fghijklmnopq")));
     }
+
+    TEST_CASE("is_fixed_arity_call")
+    {
+      using behavior::callable;
+
+      /* (fn ([]) ([a]) ([a b])) */
+      auto const fixed(callable::build_arity_flags(2, false, false));
+      CHECK(callable::is_fixed_arity_call(fixed, 0));
+      CHECK(callable::is_fixed_arity_call(fixed, 2));
+
+      /* (fn ([a]) ([a b & args])) */
+      auto const variadic(callable::build_arity_flags(2, true, false));
+      CHECK(callable::is_fixed_arity_call(variadic, 1));
+      CHECK(!callable::is_fixed_arity_call(variadic, 2));
+      CHECK(!callable::is_fixed_arity_call(variadic, 3));
+
+      /* (fn ([a]) ([a & args])) */
+      auto const ambiguous(callable::build_arity_flags(1, true, true));
+      CHECK(callable::is_fixed_arity_call(ambiguous, 1));
+      CHECK(!callable::is_fixed_arity_call(ambiguous, 2));
+    }
   }
 }
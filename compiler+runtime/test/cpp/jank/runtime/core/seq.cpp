@@ -1,7 +1,9 @@
+#include <jank/runtime/context.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/symbol.hpp>
 
 /* This must go last; doctest and glog both define CHECK and family. */
 #include <doctest/doctest.h>
@@ -32,5 +34,79 @@ namespace jank::runtime::core
         make_box<obj::persistent_vector>(std::in_place, make_box('f'), make_box('g')),
         make_box<obj::persistent_list>(std::in_place, make_box('g'))));
     }
+
+    TEST_CASE("reduce")
+    {
+      auto const plus(__rt_ctx->find_var(make_box<obj::symbol>("clojure.core/+")).unwrap());
+      /* Sums until it sees 5, so we can tell where the reduction stopped. */
+      auto const plus_until_5(
+        __rt_ctx->eval_string("(fn [acc x] (if (= 5 x) (reduced acc) (+ acc x)))"));
+
+      SUBCASE("reducible collections")
+      {
+        for(auto const code : { "(vec (range 100))",
+                                "(seq (vec (range 100)))",
+                                "(set (range 100))",
+                                "(apply sorted-set (range 100))",
+                                "(range 100)",
+                                "(range 0 100 1)" })
+        {
+          CAPTURE(code);
+          auto const coll(__rt_ctx->eval_string(code));
+          CHECK(equal(reduce(plus->deref(), make_box(0), coll), make_box(4950)));
+          CHECK(equal(reduce(plus_until_5, make_box(0), coll), make_box(10)));
+        }
+
+        CHECK(equal(reduce(plus->deref(), make_box(0), __rt_ctx->eval_string("(repeat 10 3)")),
+                    make_box(30)));
+        auto const count_to_4(
+          __rt_ctx->eval_string("(fn [acc _] (if (= 4 acc) (reduced acc) (inc acc)))"));
+        CHECK(equal(reduce(count_to_4, make_box(0), __rt_ctx->eval_string("(repeat :x)")),
+                    make_box(4)));
+      }
+
+      SUBCASE("maps reduce over entries")
+      {
+        auto const sum_vals(__rt_ctx->eval_string("(fn [acc [_ v]] (+ acc v))"));
+        for(auto const code : { "{:a 1 :b 2}", "(hash-map :a 1 :b 2)", "(sorted-map :a 1 :b 2)" })
+        {
+          CAPTURE(code);
+          auto const coll(__rt_ctx->eval_string(code));
+          CHECK(equal(reduce(sum_vals, make_box(0), coll), make_box(3)));
+        }
+      }
+
+      SUBCASE("everything else reduces over its seq")
+      {
+        CHECK(equal(reduce(plus->deref(), make_box(0), __rt_ctx->eval_string("'(1 2 3)")),
+                    make_box(6)));
+        CHECK(equal(reduce(plus->deref(), make_box(0), obj::nil::nil_const()), make_box(0)));
+      }
+    }
+
+    TEST_CASE("reduce_kv")
+    {
+      auto const sum_kv(__rt_ctx->eval_string("(fn [acc k v] (+ acc k v))"));
+      auto const stop_at_2(
+        __rt_ctx->eval_string("(fn [acc k v] (if (= 2 k) (reduced acc) (+ acc k v)))"));
+
+      for(auto const code : { "{1 10 2 20 3 30}",
+                              "(hash-map 1 10 2 20 3 30)",
+                              "(sorted-map 1 10 2 20 3 30)",
+                              "(seq (sorted-map 1 10 2 20 3 30))" })
+      {
+        CAPTURE(code);
+        auto const coll(__rt_ctx->eval_string(code));
+        CHECK(equal(reduce_kv(sum_kv, make_box(0), coll), make_box(66)));
+      }
+
+      /* Vectors use their indices as keys. */
+      auto const v(__rt_ctx->eval_string("[10 20 30]"));
+      CHECK(equal(reduce_kv(sum_kv, make_box(0), v), make_box(63)));
+      CHECK(equal(reduce_kv(stop_at_2, make_box(0), v), make_box(31)));
+      auto const m(__rt_ctx->eval_string("(sorted-map 1 10 2 20)"));
+      CHECK(equal(reduce_kv(stop_at_2, make_box(0), m), make_box(11)));
+      CHECK(equal(reduce_kv(sum_kv, make_box(0), obj::nil::nil_const()), make_box(0)));
+    }
   }
 }
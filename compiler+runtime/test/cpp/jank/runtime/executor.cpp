@@ -0,0 +1,183 @@
+#include <fmt/format.h>
+
+#include <jank/runtime/executor.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/obj/future.hpp>
+#include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  /* Tasks only get a single object, so they report back through these. */
+  static std::atomic<size_t> runs{};
+  static executor *nested_executor{};
+
+  static void count_run(object_ptr)
+  {
+    runs.fetch_add(1);
+  }
+
+  static void submit_nested(object_ptr)
+  {
+    runs.fetch_add(1);
+    for(size_t i{}; i < 10; ++i)
+    {
+      nested_executor->submit({ &count_run, obj::nil::nil_const() });
+    }
+  }
+
+  TEST_SUITE("executor")
+  {
+    TEST_CASE("runs every task")
+    {
+      runs.store(0);
+      {
+        /* Destroying the executor waits for everything which is queued. */
+        auto const ex(std::make_unique<executor>(4));
+        for(size_t i{}; i < 1000; ++i)
+        {
+          ex->submit({ &count_run, obj::nil::nil_const() });
+        }
+      }
+      CHECK(runs.load() == 1000);
+    }
+
+    TEST_CASE("tasks can submit more tasks")
+    {
+      runs.store(0);
+      {
+        auto const ex(std::make_unique<executor>(4));
+        nested_executor = ex.get();
+        for(size_t i{}; i < 100; ++i)
+        {
+          ex->submit({ &submit_nested, obj::nil::nil_const() });
+        }
+      }
+      nested_executor = nullptr;
+      CHECK(runs.load() == 1100);
+    }
+
+    TEST_CASE("shutdown")
+    {
+      runs.store(0);
+      auto const ex(std::make_unique<executor>(2));
+      for(size_t i{}; i < 100; ++i)
+      {
+        ex->submit({ &count_run, obj::nil::nil_const() });
+      }
+      ex->shutdown();
+      CHECK(runs.load() == 100);
+
+      /* Shutting down again does nothing, which the destructor relies on. */
+      ex->shutdown();
+    }
+
+    TEST_CASE("future")
+    {
+      CHECK(equal(__rt_ctx->eval_string("@(future (+ 1 2))"), make_box(3)));
+
+      SUBCASE("bindings are conveyed")
+      {
+        __rt_ctx->eval_string("(def ^:dynamic *executor-test* :root)");
+        CHECK(equal(
+          __rt_ctx->eval_string("(binding [*executor-test* :bound] @(future *executor-test*))"),
+          __rt_ctx->intern_keyword("bound").expect_ok()));
+      }
+
+      SUBCASE("errors are thrown on deref")
+      {
+        auto const f(__rt_ctx->eval_string("(future (throw :oops))"));
+        CHECK_THROWS(deref(f));
+        CHECK(is_realized(f));
+      }
+
+      SUBCASE("deref with a timeout")
+      {
+        auto const res(__rt_ctx->eval_string(R"((let [p (promise)
+                                                      f (future @p)
+                                                      timed-out (deref f 10 :timeout)
+                                                      realized-early (realized? f)]
+                                                  (deliver p 1)
+                                                  [timed-out realized-early @f (realized? f)]))"));
+        CHECK(equal(res, __rt_ctx->eval_string("[:timeout false 1 true]")));
+      }
+
+      SUBCASE("pending futures are run by whoever derefs them")
+      {
+        /* This one is never submitted, so nothing else will run it. */
+        auto const f(make_box<obj::future>(__rt_ctx->eval_string("(fn [] 1)"),
+                                           obj::persistent_hash_map::empty()));
+        CHECK(!f->is_realized());
+        CHECK(equal(f->deref(), make_box(1)));
+        CHECK(f->is_realized());
+      }
+
+      SUBCASE("cancel")
+      {
+        auto const f(make_box<obj::future>(__rt_ctx->eval_string("(fn [] 1)"),
+                                           obj::persistent_hash_map::empty()));
+        CHECK(f->cancel());
+        CHECK(!f->cancel());
+        CHECK(f->is_cancelled());
+        CHECK(f->is_realized());
+        CHECK_THROWS(f->deref());
+
+        auto const done(make_box<obj::future>(__rt_ctx->eval_string("(fn [] 1)"),
+                                              obj::persistent_hash_map::empty()));
+        done->run();
+        CHECK(!done->cancel());
+        CHECK(equal(done->deref(), make_box(1)));
+      }
+    }
+
+    TEST_CASE("promise")
+    {
+      auto const p(make_box<obj::promise>());
+      CHECK(!p->is_realized());
+      CHECK(equal(p->deref(make_box(0), make_box(2)), make_box(2)));
+      CHECK(equal(deliver(p, make_box(1)), p));
+      CHECK(equal(deliver(p, make_box(3)), obj::nil::nil_const()));
+      CHECK(p->is_realized());
+      CHECK(equal(p->deref(), make_box(1)));
+    }
+
+    TEST_CASE("blocking derefs don't starve the executor")
+    {
+      /* Every thread is soon blocked on the promise, while the future which delivers it is
+       * still queued behind the others. */
+      auto const blocked(std::max<size_t>(64, __rt_ctx->get_executor().thread_count * 4));
+      CHECK(equal(__rt_ctx->eval_string(fmt::format(R"((let [p (promise)]
+                                                        (dotimes [_ {}] (future @p))
+                                                        (future (deliver p 1))
+                                                        @p))",
+                                                    blocked)),
+                  make_box(1)));
+
+      SUBCASE("With a timeout")
+      {
+        auto const code(fmt::format(R"((let [p (promise)
+                                            wait #(future (deref p 10000 :timeout))
+                                            fs (vec (repeatedly {} wait))]
+                                        (future (deliver p 1))
+                                        (set (map deref fs))))",
+                                    blocked));
+        CHECK(equal(__rt_ctx->eval_string(code), __rt_ctx->eval_string("#{1}")));
+      }
+    }
+
+    TEST_CASE("pmap")
+    {
+      CHECK(equal(__rt_ctx->eval_string("(vec (pmap inc (range 100)))"),
+                  __rt_ctx->eval_string("(vec (range 1 101))")));
+      CHECK(equal(__rt_ctx->eval_string("(vec (pmap + [1 2 3] [10 20 30 40]))"),
+                  __rt_ctx->eval_string("[11 22 33]")));
+      CHECK(equal(__rt_ctx->eval_string("(vec (pcalls (fn [] 1) (fn [] 2)))"),
+                  __rt_ctx->eval_string("[1 2]")));
+    }
+  }
+}
@@ -0,0 +1,253 @@
+#include <array>
+#include <cstdlib>
+#include <fstream>
+
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fmt/format.h>
+
+#include <jank/runtime/module/loader.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/util/process_location.hpp>
+#include <jank/util/scope_exit.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::module
+{
+  /* A module path and a compile cache of our own, so we only ever see our own objects. Since
+   * modules and their load functions stay around for the rest of the process, each test
+   * uses its own module names. */
+  struct compile_cache_dirs
+  {
+    compile_cache_dirs()
+      : compile_cache_dirs{ boost::filesystem::temp_directory_path()
+                              / boost::filesystem::unique_path("jank-compile-cache-%%%%-%%%%"),
+                            true }
+    {
+    }
+
+    compile_cache_dirs(boost::filesystem::path const &root, native_bool const owned = false)
+      : root{ root }
+      , src{ root / "src" }
+      , cache{ root / "cache" }
+      , owned{ owned }
+    {
+      boost::filesystem::create_directories(src);
+      boost::filesystem::create_directories(cache);
+    }
+
+    ~compile_cache_dirs()
+    {
+      if(owned)
+      {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(root, ec);
+      }
+    }
+
+    void write(native_persistent_string const &file, native_persistent_string const &code) const
+    {
+      std::ofstream{ (src / file.c_str()).string() } << code;
+    }
+
+    size_t count(native_persistent_string const &extension) const
+    {
+      size_t ret{};
+      for(auto const &f : boost::filesystem::directory_iterator{ cache })
+      {
+        ret += f.path().string().ends_with(extension.c_str());
+      }
+      return ret;
+    }
+
+    /* The compile cache is only used while this is alive. */
+    util::scope_exit use() const
+    {
+      __rt_ctx->compile_cache_dir = native_persistent_string{ cache.string() };
+      return util::scope_exit{ [] { __rt_ctx->compile_cache_dir = none; } };
+    }
+
+    boost::filesystem::path root, src, cache;
+    native_bool owned{};
+  };
+
+  static native_bool has_load_function(native_persistent_string const &module)
+  {
+    return __rt_ctx->jit_prc.find_symbol<object *(*)()>(module_to_load_function(module)).is_ok();
+  }
+
+  static object_ptr var_value(native_persistent_string const &qualified_name)
+  {
+    return __rt_ctx->find_var(make_box<obj::symbol>(qualified_name)).unwrap()->deref();
+  }
+
+  TEST_SUITE("compile cache")
+  {
+    TEST_CASE("hit")
+    {
+      compile_cache_dirs const dirs;
+      auto const using_cache(dirs.use());
+      dirs.write("compile_cache_hit.jank", "(ns compile-cache-hit) (def value 1)");
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+
+      /* The first load evaluates the source, so nothing is loaded from an object. */
+      CHECK(__rt_ctx->load_module("/compile-cache-hit", origin::source).is_ok());
+      CHECK(dirs.count(".o") == 1);
+      CHECK(dirs.count(".deps") == 1);
+      CHECK(dirs.count(".tmp") == 0);
+      CHECK(!has_load_function("compile-cache-hit"));
+
+      CHECK(__rt_ctx->load_module("/compile-cache-hit", origin::source).is_ok());
+      CHECK(dirs.count(".o") == 1);
+      CHECK(has_load_function("compile-cache-hit"));
+      CHECK(equal(var_value("compile-cache-hit/value"), make_box(1)));
+    }
+
+    TEST_CASE("miss after the source changes")
+    {
+      compile_cache_dirs const dirs;
+      auto const using_cache(dirs.use());
+      dirs.write("compile_cache_change.jank", "(ns compile-cache-change) (def value 1)");
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+
+      CHECK(__rt_ctx->load_module("/compile-cache-change", origin::source).is_ok());
+      dirs.write("compile_cache_change.jank", "(ns compile-cache-change) (def value 2)");
+      CHECK(__rt_ctx->load_module("/compile-cache-change", origin::source).is_ok());
+
+      CHECK(dirs.count(".o") == 2);
+      CHECK(!has_load_function("compile-cache-change"));
+      CHECK(equal(var_value("compile-cache-change/value"), make_box(2)));
+    }
+
+    TEST_CASE("miss after a dependency changes")
+    {
+      compile_cache_dirs const dirs;
+      auto const using_cache(dirs.use());
+      dirs.write("compile_cache_macro.jank", "(ns compile-cache-macro) (defmacro m [] 1)");
+      dirs.write("compile_cache_user.jank",
+                 "(ns compile-cache-user (:require compile-cache-macro))"
+                 "(def value (compile-cache-macro/m))");
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+
+      CHECK(__rt_ctx->load_module("/compile-cache-user", origin::source).is_ok());
+      CHECK(equal(var_value("compile-cache-user/value"), make_box(1)));
+
+      /* The user's object has the old expansion of the macro baked into it. */
+      dirs.write("compile_cache_macro.jank", "(ns compile-cache-macro) (defmacro m [] 2)");
+      CHECK(__rt_ctx->load_module("/compile-cache-macro", origin::source).is_ok());
+      CHECK(__rt_ctx->load_module("/compile-cache-user", origin::source).is_ok());
+
+      /* Each version of the macro has its own object, as does the user for each of them. */
+      CHECK(dirs.count(".o") == 4);
+      CHECK(dirs.count(".deps") == 3);
+      CHECK(!has_load_function("compile-cache-user"));
+      CHECK(equal(var_value("compile-cache-user/value"), make_box(2)));
+
+      SUBCASE("Going back to an older dependency hits")
+      {
+        dirs.write("compile_cache_macro.jank", "(ns compile-cache-macro) (defmacro m [] 1)");
+        CHECK(__rt_ctx->load_module("/compile-cache-macro", origin::source).is_ok());
+        CHECK(__rt_ctx->load_module("/compile-cache-user", origin::source).is_ok());
+
+        CHECK(dirs.count(".o") == 4);
+        CHECK(has_load_function("compile-cache-user"));
+        CHECK(equal(var_value("compile-cache-user/value"), make_box(1)));
+      }
+    }
+
+    TEST_CASE("a manifest which can't be read is an error")
+    {
+      compile_cache_dirs const dirs;
+      auto const using_cache(dirs.use());
+      dirs.write("compile_cache_manifest.jank", "(ns compile-cache-manifest) (def value 1)");
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+      CHECK(__rt_ctx->load_module("/compile-cache-manifest", origin::source).is_ok());
+
+      /* A directory exists, but can't be read like a file. */
+      for(auto const &f : boost::filesystem::directory_iterator{ dirs.cache })
+      {
+        if(f.path().extension() == ".deps")
+        {
+          boost::filesystem::remove(f.path());
+          boost::filesystem::create_directory(f.path());
+        }
+      }
+      CHECK(__rt_ctx->load_module("/compile-cache-manifest", origin::source).is_err());
+    }
+
+    TEST_CASE("module named differently from its ns")
+    {
+      compile_cache_dirs const dirs;
+      auto const using_cache(dirs.use());
+      dirs.write("compile_cache_file.jank", "(ns compile-cache-other-ns) (def value 1)");
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+
+      CHECK(__rt_ctx->load_module("/compile-cache-file", origin::source).is_ok());
+      CHECK(dirs.count(".o") == 1);
+      CHECK(dirs.count(".tmp") == 0);
+
+      CHECK(__rt_ctx->load_module("/compile-cache-file", origin::source).is_ok());
+      CHECK(has_load_function("compile-cache-file"));
+    }
+
+    /* Run by the test below, in separate processes. */
+    TEST_CASE("racing process" * doctest::skip())
+    {
+      auto const root(std::getenv("JANK_TEST_COMPILE_CACHE_ROOT"));
+      if(!root)
+      {
+        return;
+      }
+
+      compile_cache_dirs const dirs{ root };
+      auto const using_cache(dirs.use());
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+      CHECK(__rt_ctx->load_module("/compile-cache-race", origin::source).is_ok());
+    }
+
+    TEST_CASE("processes racing to write the same object")
+    {
+      compile_cache_dirs const dirs;
+      dirs.write("compile_cache_race.jank", "(ns compile-cache-race) (def value 1)");
+      auto exe(util::process_location().unwrap().string());
+      setenv("JANK_TEST_COMPILE_CACHE_ROOT", dirs.root.c_str(), 1);
+
+      native_vector<pid_t> children;
+      for(size_t i{}; i < 4; ++i)
+      {
+        std::string test_case{ "--test-case=racing process" }, no_skip{ "--no-skip" };
+        std::array<char *, 4> args{ exe.data(), test_case.data(), no_skip.data(), nullptr };
+        pid_t pid{};
+        REQUIRE(posix_spawn(&pid, exe.c_str(), nullptr, nullptr, args.data(), environ) == 0);
+        children.emplace_back(pid);
+      }
+
+      for(auto const pid : children)
+      {
+        int status{};
+        REQUIRE(waitpid(pid, &status, 0) == pid);
+        CHECK(WIFEXITED(status));
+        CHECK(WEXITSTATUS(status) == 0);
+      }
+      unsetenv("JANK_TEST_COMPILE_CACHE_ROOT");
+
+      /* Whoever renamed last won, and nobody left a temporary file behind. */
+      CHECK(dirs.count(".o") == 1);
+      CHECK(dirs.count(".deps") == 1);
+      CHECK(dirs.count(".tmp") == 0);
+
+      auto const using_cache(dirs.use());
+      __rt_ctx->module_loader.add_path(dirs.src.string());
+      CHECK(__rt_ctx->load_module("/compile-cache-race", origin::source).is_ok());
+      CHECK(has_load_function("compile-cache-race"));
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#include <jank/runtime/obj/character.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  TEST_SUITE("character")
+  {
+    TEST_CASE("cache")
+    {
+      SUBCASE("ASCII characters are identical")
+      {
+        for(int i{}; i < 128; ++i)
+        {
+          auto const ch(static_cast<char>(i));
+          CHECK(make_box(ch).data == make_box(ch).data);
+          CHECK(make_box(ch)->data == native_persistent_string(1, ch));
+        }
+      }
+
+      SUBCASE("Strings hand out cached characters")
+      {
+        auto const s(make_box("jank"));
+        CHECK(s->get(make_box(0)) == make_box('j'));
+      }
+
+      SUBCASE("Non-ASCII bytes are still equal")
+      {
+        auto const ch(static_cast<char>(0xE9));
+        CHECK(equal(make_box(ch), make_box(ch)));
+      }
+    }
+  }
+}
@@ -0,0 +1,119 @@
+#include <filesystem>
+#include <fstream>
+
+#include <jank/runtime/obj/form_reader.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  TEST_SUITE("form_reader")
+  {
+    TEST_CASE("String")
+    {
+      auto const eof(make_box<persistent_string>("eof"));
+      auto const reader(make_box<form_reader>(make_box<persistent_string>("1 :foo [2 \"bar\"]")));
+      CHECK(equal(reader->read(eof), make_box(1)));
+      CHECK(equal(reader->read(eof), __rt_ctx->intern_keyword("foo").expect_ok()));
+      CHECK(equal(reader->read(eof),
+                  make_box<persistent_vector>(
+                    std::in_place,
+                    make_box(2),
+                    make_box<persistent_string>("bar"))));
+      CHECK(reader->read(eof) == eof);
+      CHECK(reader->read(eof) == eof);
+    }
+
+    TEST_CASE("Empty")
+    {
+      auto const eof(make_box<persistent_string>("eof"));
+      auto const reader(make_box<form_reader>(make_box<persistent_string>("  ; nothing\n")));
+      CHECK(reader->read(eof) == eof);
+    }
+
+    TEST_CASE("Invalid")
+    {
+      auto const eof(make_box<persistent_string>("eof"));
+      auto const reader(make_box<form_reader>(make_box<persistent_string>("1 (2")));
+      CHECK(equal(reader->read(eof), make_box(1)));
+      CHECK_THROWS_AS(reader->read(eof), error_ptr);
+    }
+
+    TEST_CASE("File")
+    {
+      auto const path(std::filesystem::temp_directory_path() / "jank-form-reader-test.edn");
+      {
+        std::ofstream out{ path };
+        for(size_t i{}; i < 1000; ++i)
+        {
+          out << "{:id " << i << " :tags [:a :b]}\n";
+        }
+      }
+
+      auto const eof(make_box<persistent_string>("eof"));
+      auto const reader(form_reader::open(path.string()).expect_ok());
+      auto const id(__rt_ctx->intern_keyword("id").expect_ok());
+      size_t count{};
+      for(auto form(reader->read(eof)); form != eof; form = reader->read(eof))
+      {
+        CHECK(equal(get(form, id), make_box(static_cast<native_integer>(count))));
+        ++count;
+      }
+      CHECK(count == 1000);
+
+      reader->close();
+      CHECK(reader->read(eof) == eof);
+      std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Releasing pages")
+    {
+      auto const path(std::filesystem::temp_directory_path() / "jank-form-reader-release.edn");
+      {
+        std::ofstream out{ path };
+        for(size_t i{}; i < 10000; ++i)
+        {
+          out << "{:id " << i << " :tags [:a :b]}\n";
+        }
+      }
+
+      auto const eof(make_box<persistent_string>("eof"));
+      auto const reader(form_reader::open(path.string()).expect_ok());
+      /* The default threshold is larger than any file we'd want to write here. */
+      reader->release_threshold = 4096;
+      auto const id(__rt_ctx->intern_keyword("id").expect_ok());
+      size_t count{};
+      for(auto form(reader->read(eof)); form != eof; form = reader->read(eof))
+      {
+        CHECK(equal(get(form, id), make_box(static_cast<native_integer>(count))));
+        ++count;
+      }
+      CHECK(count == 10000);
+      CHECK(reader->release_threshold <= reader->released);
+      CHECK(reader->released < std::filesystem::file_size(path));
+
+      reader->close();
+      std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Missing file")
+    {
+      CHECK(form_reader::open("/this/does/not/exist.edn").is_err());
+    }
+
+    TEST_CASE("Closed")
+    {
+      auto const eof(make_box<persistent_string>("eof"));
+      auto const reader(make_box<form_reader>(make_box<persistent_string>("1 2 3")));
+      CHECK(equal(reader->read(eof), make_box(1)));
+      reader->close();
+      CHECK(reader->read(eof) == eof);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+#include <thread>
+
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/symbol.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/util/gc_thread.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  TEST_SUITE("keyword")
+  {
+    TEST_CASE("intern")
+    {
+      SUBCASE("Unqualified")
+      {
+        auto const kw(__rt_ctx->intern_keyword("kw-test").expect_ok());
+        CHECK(kw == __rt_ctx->intern_keyword("kw-test").expect_ok());
+        CHECK(kw == __rt_ctx->intern_keyword("", "kw-test").expect_ok());
+        CHECK(kw->sym->ns.empty());
+        CHECK(kw->sym->name == "kw-test");
+      }
+
+      SUBCASE("Qualified")
+      {
+        auto const kw(__rt_ctx->intern_keyword("kw.test/foo").expect_ok());
+        CHECK(kw == __rt_ctx->intern_keyword("kw.test", "foo").expect_ok());
+        CHECK(kw != __rt_ctx->intern_keyword("kw.test/bar").expect_ok());
+        CHECK(kw != __rt_ctx->intern_keyword("foo").expect_ok());
+        CHECK(kw->sym->ns == "kw.test");
+        CHECK(kw->sym->name == "foo");
+      }
+
+      SUBCASE("Only the first slash separates")
+      {
+        auto const kw(__rt_ctx->intern_keyword("kw.test/foo/bar").expect_ok());
+        CHECK(kw->sym->ns == "kw.test");
+        CHECK(kw->sym->name == "foo/bar");
+        CHECK(__rt_ctx->intern_keyword("/").expect_ok()->sym->name == "/");
+      }
+
+      SUBCASE("Across threads")
+      {
+        constexpr size_t thread_count{ 8 };
+        native_vector<keyword_ptr> interned(thread_count);
+        native_vector<std::thread> threads;
+        for(size_t i{}; i < thread_count; ++i)
+        {
+          threads.emplace_back([&, i] {
+            util::gc_thread_scope const gc_thread;
+            interned[i] = __rt_ctx->intern_keyword("kw.test", "racy").expect_ok();
+          });
+        }
+        for(auto &t : threads)
+        {
+          t.join();
+        }
+        for(auto const kw : interned)
+        {
+          CHECK(kw == interned[0]);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,111 @@
+#include <atomic>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <jank/runtime/obj/lazy_sequence.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/util/gc_thread.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  TEST_SUITE("lazy_sequence")
+  {
+    TEST_CASE("realized?")
+    {
+      CHECK(equal(__rt_ctx->eval_string(R"((let [s (lazy-seq [1 2])
+                                                 before (realized? s)]
+                                             (first s)
+                                             [before (realized? s)]))"),
+                  __rt_ctx->eval_string("[false true]")));
+
+      /* Once fn has been called, we're realized, even if what it returned is still lazy. */
+      CHECK(equal(__rt_ctx->eval_string(R"((let [s (lazy-seq (lazy-seq [1]))]
+                                             (seq s)
+                                             (realized? s)))"),
+                  __rt_ctx->eval_string("true")));
+
+      SUBCASE("An empty seq is realized")
+      {
+        CHECK(equal(__rt_ctx->eval_string("(let [s (lazy-seq nil)] (seq s) (realized? s))"),
+                    __rt_ctx->eval_string("true")));
+      }
+
+      SUBCASE("A failed realization can be retried")
+      {
+        auto const s(__rt_ctx->eval_string(R"((let [tries (atom 0)]
+                                                 (lazy-seq
+                                                   (when (= 1 (swap! tries inc))
+                                                     (throw :first-try))
+                                                   [1])))"));
+        CHECK_THROWS(first(s));
+        CHECK(!expect_object<lazy_sequence>(s)->is_realized());
+        CHECK(equal(first(s), make_box(1)));
+        CHECK(expect_object<lazy_sequence>(s)->is_realized());
+      }
+
+      SUBCASE("fn can walk back into its own seq")
+      {
+        /* This is on the same thread which is realizing the seq, so it mustn't wait. */
+        CHECK(equal(__rt_ctx->eval_string(R"((def lazy-sequence-test-self nil)
+                                               (def lazy-sequence-test-self
+                                                 (lazy-seq [(realized? lazy-sequence-test-self)]))
+                                               (first lazy-sequence-test-self))"),
+                    __rt_ctx->eval_string("false")));
+      }
+    }
+
+    TEST_CASE("Each thunk runs once across threads")
+    {
+      constexpr native_integer length{ 2000 };
+      auto const thread_count(std::max(4u, std::thread::hardware_concurrency()));
+
+      __rt_ctx->eval_string(R"((def lazy-sequence-test-calls (atom 0))
+                               (defn lazy-sequence-test-nums [n limit]
+                                 (lazy-seq
+                                   (swap! lazy-sequence-test-calls inc)
+                                   (when (< n limit)
+                                     (cons n (lazy-sequence-test-nums (inc n) limit))))))"));
+      auto const s(__rt_ctx->eval_string(
+        fmt::format("(lazy-sequence-test-nums 0 {})", length)));
+
+      std::atomic_bool go{};
+      native_vector<native_integer> sums(thread_count);
+      native_vector<native_integer> counts(thread_count);
+      native_vector<std::thread> threads;
+      for(size_t i{}; i < thread_count; ++i)
+      {
+        threads.emplace_back([&, i] {
+          util::gc_thread_scope const gc_thread;
+          while(!go.load())
+          {
+          }
+          for(auto it(seq(s)); it != nil::nil_const(); it = next(it))
+          {
+            sums[i] += to_int(first(it));
+            ++counts[i];
+          }
+        });
+      }
+      go.store(true);
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+
+      for(size_t i{}; i < thread_count; ++i)
+      {
+        CHECK(counts[i] == length);
+        CHECK(sums[i] == length * (length - 1) / 2);
+      }
+      /* One thunk per element, plus the empty one at the end. */
+      CHECK(equal(__rt_ctx->eval_string("@lazy-sequence-test-calls"), make_box(length + 1)));
+    }
+  }
+}
@@ -0,0 +1,136 @@
+#include <atomic>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <jank/runtime/obj/multi_function.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/util/gc_thread.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  TEST_SUITE("multi_function")
+  {
+    TEST_CASE("isa?")
+    {
+      auto const h(__rt_ctx->eval_string(R"((-> (make-hierarchy)
+                                               (derive :mf/square :mf/rect)
+                                               (derive :mf/rect :mf/shape)))"));
+      auto const kw([](native_persistent_string_view const &s) -> object_ptr {
+        return __rt_ctx->intern_keyword(s).expect_ok();
+      });
+
+      CHECK(isa(h, kw("mf/square"), kw("mf/square")));
+      CHECK(isa(h, kw("mf/square"), kw("mf/shape")));
+      CHECK(!isa(h, kw("mf/shape"), kw("mf/square")));
+      CHECK(isa(h,
+                make_box<persistent_vector>(std::in_place, kw("mf/square"), make_box(1)),
+                make_box<persistent_vector>(std::in_place, kw("mf/shape"), make_box(1))));
+      CHECK(!isa(h,
+                 make_box<persistent_vector>(std::in_place, kw("mf/square")),
+                 make_box<persistent_vector>(std::in_place, kw("mf/shape"), make_box(1))));
+      CHECK(!isa(h, kw("mf/circle"), kw("mf/shape")));
+    }
+
+    TEST_CASE("dispatch")
+    {
+      __rt_ctx->eval_string(R"((defmulti mf-area :shape)
+                               (defmethod mf-area ::mf-rect [_] :rect)
+                               (defmethod mf-area :default [_] :default))"));
+      CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-rect})"),
+                  __rt_ctx->eval_string(":rect")));
+      CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-square})"),
+                  __rt_ctx->eval_string(":default")));
+
+      SUBCASE("The cache follows the hierarchy")
+      {
+        __rt_ctx->eval_string("(derive ::mf-square ::mf-rect)");
+        CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-square})"),
+                    __rt_ctx->eval_string(":rect")));
+        __rt_ctx->eval_string("(underive ::mf-square ::mf-rect)");
+        CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-square})"),
+                    __rt_ctx->eval_string(":default")));
+      }
+
+      SUBCASE("The cache follows the methods")
+      {
+        __rt_ctx->eval_string("(defmethod mf-area ::mf-square [_] :square)");
+        CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-square})"),
+                    __rt_ctx->eval_string(":square")));
+        __rt_ctx->eval_string("(remove-method mf-area ::mf-square)");
+        CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-square})"),
+                    __rt_ctx->eval_string(":default")));
+      }
+
+      SUBCASE("Preferences")
+      {
+        __rt_ctx->eval_string(R"((derive ::mf-cube ::mf-rect)
+                                 (derive ::mf-cube ::mf-solid)
+                                 (defmethod mf-area ::mf-solid [_] :solid))"));
+        CHECK_THROWS(__rt_ctx->eval_string("(mf-area {:shape ::mf-cube})"));
+        __rt_ctx->eval_string("(prefer-method mf-area ::mf-solid ::mf-rect)");
+        CHECK(equal(__rt_ctx->eval_string("(mf-area {:shape ::mf-cube})"),
+                    __rt_ctx->eval_string(":solid")));
+      }
+    }
+
+    TEST_CASE("Concurrent dispatch")
+    {
+      constexpr native_integer method_count{ 50 };
+      constexpr size_t thread_count{ 8 };
+
+      auto const mf(__rt_ctx->eval_string(
+        fmt::format(R"((defmulti mf-concurrent identity)
+                       (dotimes [i {}]
+                         (defmethod mf-concurrent i [x] (* x 2)))
+                       mf-concurrent)",
+                    method_count)));
+
+      std::atomic_bool go{};
+      std::atomic<size_t> failures{};
+      native_vector<std::thread> threads;
+      for(size_t t{}; t < thread_count; ++t)
+      {
+        threads.emplace_back([&, t] {
+          util::gc_thread_scope const gc_thread;
+          while(!go.load())
+          {
+          }
+          for(native_integer round{}; round < 20; ++round)
+          {
+            for(native_integer i{}; i < method_count; ++i)
+            {
+              /* Each thread walks the methods in a different order. */
+              auto const n((i + static_cast<native_integer>(t) * 7) % method_count);
+              if(to_int(dynamic_call(mf, make_box(n))) != n * 2)
+              {
+                ++failures;
+              }
+            }
+          }
+        });
+      }
+      go.store(true);
+
+      /* Keep invalidating the cache while the other threads are dispatching. */
+      for(size_t i{}; i < 20; ++i)
+      {
+        __rt_ctx->eval_string("(defmethod mf-concurrent :extra [x] x)");
+        __rt_ctx->eval_string("(remove-method mf-concurrent :extra)");
+      }
+
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+      CHECK(failures.load() == 0);
+    }
+  }
+}
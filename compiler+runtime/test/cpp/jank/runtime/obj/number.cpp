@@ -0,0 +1,70 @@
+#include <gc/gc.h>
+
+#include <jank/runtime/obj/number.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  /* Boehm only gives us a running total, so we sample it around a number of runs. */
+  template <typename F>
+  static size_t allocated_bytes_per_run(size_t const runs, F const &f)
+  {
+    auto const before(GC_get_total_bytes());
+    for(size_t i{}; i < runs; ++i)
+    {
+      f();
+    }
+    return (GC_get_total_bytes() - before) / runs;
+  }
+
+  TEST_SUITE("integer")
+  {
+    TEST_CASE("cache")
+    {
+      SUBCASE("Cached values are identical")
+      {
+        for(auto i(integer::cache_min); i <= integer::cache_max; ++i)
+        {
+          auto const boxed(make_box(i));
+          CHECK(boxed->data == i);
+          CHECK(boxed.data == make_box(i).data);
+        }
+      }
+
+      SUBCASE("Uncached values are still equal")
+      {
+        auto const below(make_box(integer::cache_min - 1));
+        auto const above(make_box(integer::cache_max + 1));
+        CHECK(below->data == integer::cache_min - 1);
+        CHECK(above->data == integer::cache_max + 1);
+        CHECK(below.data != make_box(integer::cache_min - 1).data);
+        CHECK(equal(above, make_box(integer::cache_max + 1)));
+      }
+
+      SUBCASE("Math results use the cache")
+      {
+        CHECK(add(erase(make_box(1)), erase(make_box(2))) == make_box(3));
+        CHECK(mul(erase(make_box(4)), erase(make_box(8))) == make_box(32));
+        CHECK(inc(erase(make_box(-1))) == make_box(0));
+      }
+
+      SUBCASE("Boxing a cached value doesn't allocate")
+      {
+        uintptr_t sum{};
+        auto const box_cached([&] {
+          for(auto i(integer::cache_min); i <= integer::cache_max; ++i)
+          {
+            sum += reinterpret_cast<uintptr_t>(make_box(i).data);
+          }
+        });
+        CHECK(allocated_bytes_per_run(100, box_cached) == 0);
+        CHECK(sum != 0);
+      }
+    }
+  }
+}
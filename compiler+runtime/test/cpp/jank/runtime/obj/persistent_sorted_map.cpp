@@ -0,0 +1,56 @@
+#include <jank/runtime/obj/persistent_sorted_map.hpp>
+#include <jank/runtime/obj/persistent_sorted_set.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static void collect()
+  {
+    GC_gcollect();
+    GC_invoke_finalizers();
+  }
+
+  TEST_SUITE("persistent_sorted_map")
+  {
+    TEST_CASE("Assoc and dissoc")
+    {
+      object_ptr m{ persistent_sorted_map::empty() };
+      for(native_integer i{}; i < 100; ++i)
+      {
+        m = assoc(m, make_box(i), make_box(i * 2));
+      }
+      for(native_integer i{}; i < 50; ++i)
+      {
+        m = dissoc(m, make_box(i));
+      }
+      collect();
+
+      CHECK(sequence_length(m) == 50);
+      CHECK(equal(first(first(m)), make_box(50)));
+      CHECK(equal(get(m, make_box(99)), make_box(198)));
+      CHECK(get(m, make_box(0)) == nil::nil_const());
+    }
+
+    TEST_CASE("Finalizer")
+    {
+      /* Registering a null finalizer hands back the one which was there before, which we
+       * then put back. */
+      auto const finalizer([](void * const o) {
+        GC_finalization_proc fn{};
+        void *data{};
+        GC_register_finalizer_no_order(o, nullptr, nullptr, &fn, &data);
+        GC_register_finalizer_no_order(o, fn, data, nullptr, nullptr);
+        return fn;
+      });
+
+      CHECK(finalizer(make_box<persistent_sorted_map>().data)
+            == &runtime::detail::finalize<persistent_sorted_map>);
+      CHECK(finalizer(make_box<persistent_sorted_set>().data)
+            == &runtime::detail::finalize<persistent_sorted_set>);
+    }
+  }
+}
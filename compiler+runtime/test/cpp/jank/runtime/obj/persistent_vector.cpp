@@ -1,4 +1,7 @@
 #include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_vector_sequence.hpp>
+#include <jank/runtime/obj/array_chunk.hpp>
+#include <jank/runtime/core.hpp>
 #include <jank/runtime/core/make_box.hpp>
 
 /* This must go last; doctest and glog both define CHECK and family. */
@@ -79,4 +82,70 @@ namespace jank::runtime::obj
                    make_box<persistent_vector>(std::in_place, make_box('f'))));
     }
   }
+
+  TEST_SUITE("persistent_vector_sequence")
+  {
+    static persistent_vector_ptr make_vector(native_integer const count)
+    {
+      runtime::detail::native_transient_vector trans;
+      for(native_integer i{}; i < count; ++i)
+      {
+        trans.push_back(make_box(i));
+      }
+      return make_box<persistent_vector>(trans.persistent());
+    }
+
+    TEST_CASE("chunked")
+    {
+      /* Enough for a few full leaves, plus a partial tail. */
+      constexpr native_integer count{ 100 };
+      auto const v(make_vector(count));
+
+      SUBCASE("chunks cover every element, in order")
+      {
+        native_integer expected{};
+        for(auto s(v->seq()); s != nullptr; s = s->chunked_next())
+        {
+          auto const chunk(s->chunked_first());
+          CHECK(0 < chunk->count());
+          CHECK(chunk->count() <= count);
+          for(size_t i{}; i < chunk->count(); ++i)
+          {
+            CHECK(equal(chunk->nth(make_box(i)), make_box(expected)));
+            ++expected;
+          }
+        }
+        CHECK(expected == count);
+      }
+
+      SUBCASE("starting part way through a leaf")
+      {
+        auto const s(make_box<persistent_vector_sequence>(v, 3));
+        auto const chunk(s->chunked_first());
+        CHECK(equal(chunk->nth(make_box(0)), make_box(3)));
+        CHECK(equal(s->chunked_next()->first(),
+                    make_box(3 + static_cast<native_integer>(chunk->count()))));
+      }
+
+      SUBCASE("chunks share the vector's storage")
+      {
+        auto const chunk(v->seq()->chunked_first());
+        CHECK(chunk->buffer.empty());
+        CHECK(chunk->data == &v->data[0]);
+
+        auto const next(chunk->chunk_next());
+        CHECK(next->data == chunk->data);
+        CHECK(next->count() == chunk->count() - 1);
+        CHECK(equal(next->nth(make_box(0)), make_box(1)));
+      }
+
+      SUBCASE("chunked_next at the end")
+      {
+        auto const s(make_box<persistent_vector_sequence>(v, static_cast<size_t>(count - 1)));
+        CHECK(s->chunked_first()->count() == 1);
+        CHECK(s->chunked_next() == nullptr);
+        CHECK(is_chunked_seq(s));
+      }
+    }
+  }
 }
@@ -0,0 +1,115 @@
+#include <fmt/format.h>
+
+#include <jank/runtime/obj/transient_array_map.hpp>
+#include <jank/runtime/obj/transient_hash_map.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ptr make_keyword(size_t const i)
+  {
+    return __rt_ctx->intern_keyword(fmt::format("k{}", i)).expect_ok();
+  }
+
+  static object_ptr make_string(size_t const i)
+  {
+    return make_box<persistent_string>(fmt::format("k{}", i));
+  }
+
+  TEST_SUITE("transient_array_map")
+  {
+    TEST_CASE("Assoc in place")
+    {
+      auto const trans(transient_array_map::empty());
+      for(size_t i{}; i < persistent_array_map::max_size; ++i)
+      {
+        CHECK(runtime::assoc_in_place(trans, make_keyword(i), make_box(i)) == object_ptr{ trans });
+      }
+      CHECK(trans->count() == persistent_array_map::max_size);
+
+      /* Updating an existing key doesn't need any more room. */
+      CHECK(trans->assoc_in_place(make_keyword(0), make_box(100)) == object_ptr{ trans });
+      CHECK(equal(trans->get(make_keyword(0)), make_box(100)));
+
+      auto const m(trans->to_persistent());
+      CHECK(m->count() == persistent_array_map::max_size);
+      CHECK(equal(m->get(make_keyword(1)), make_box(1)));
+      CHECK_THROWS(trans->count());
+    }
+
+    TEST_CASE("Promotion")
+    {
+      auto const trans(transient_array_map::empty());
+      for(size_t i{}; i < persistent_array_map::max_size; ++i)
+      {
+        trans->assoc_in_place(make_string(i), make_box(i));
+      }
+
+      auto const promoted(trans->assoc_in_place(make_string(100), make_box(100)));
+      REQUIRE(promoted->type == object_type::transient_hash_map);
+      CHECK_THROWS(trans->count());
+
+      auto const m(runtime::persistent(promoted));
+      CHECK(m->type == object_type::persistent_hash_map);
+      CHECK(runtime::sequence_length(m) == persistent_array_map::max_size + 1);
+      for(size_t i{}; i < persistent_array_map::max_size; ++i)
+      {
+        CHECK(equal(runtime::get(m, make_string(i)), make_box(i)));
+      }
+      CHECK(equal(runtime::get(m, make_string(100)), make_box(100)));
+    }
+
+    TEST_CASE("From persistent")
+    {
+      auto const m(persistent_array_map::create_unique(make_keyword(0), make_box(0)));
+      auto const trans(m->to_transient());
+      trans->assoc_in_place(make_keyword(1), make_box(1));
+      trans->dissoc_in_place(make_keyword(0));
+
+      /* The original is untouched. */
+      CHECK(m->count() == 1);
+      CHECK(equal(m->get(make_keyword(0)), make_box(0)));
+
+      auto const result(trans->to_persistent());
+      CHECK(result->count() == 1);
+      CHECK(equal(result->get(make_keyword(1)), make_box(1)));
+      CHECK(!result->contains(make_keyword(0)));
+    }
+
+    TEST_CASE("Conj in place")
+    {
+      auto const trans(transient_array_map::empty());
+      trans->conj_in_place(
+        make_box<persistent_vector>(std::in_place, make_keyword(0), make_box(0)));
+      CHECK(equal(trans->get(make_keyword(0)), make_box(0)));
+
+      auto const other(persistent_array_map::create_unique(make_keyword(1), make_box(1)));
+      CHECK(trans->conj_in_place(other) == object_ptr{ trans });
+      CHECK(trans->count() == 2);
+
+      CHECK_THROWS(trans->conj_in_place(make_box(1)));
+    }
+
+    TEST_CASE("Equal keys")
+    {
+      auto const trans(transient_array_map::empty());
+      trans->assoc_in_place(make_keyword(0), make_box(0));
+      trans->assoc_in_place(make_string(0), make_box(1));
+
+      /* Equal, but not identical, keys are found, while keywords only match themselves. */
+      CHECK(equal(trans->get(make_string(0)), make_box(1)));
+      CHECK(equal(trans->get(make_keyword(0)), make_box(0)));
+      CHECK(trans->get(make_keyword(1)) == nil::nil_const());
+      CHECK(trans->get(make_string(1)) == nil::nil_const());
+    }
+  }
+}
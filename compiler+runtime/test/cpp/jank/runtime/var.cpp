@@ -0,0 +1,155 @@
+#include <atomic>
+#include <thread>
+
+#include <jank/runtime/var.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/util/gc_thread.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  TEST_SUITE("var")
+  {
+    TEST_CASE("root")
+    {
+      auto const v(__rt_ctx->intern_var("clojure.core", "var-test-root").expect_ok());
+      CHECK(!v->is_bound());
+
+      v->bind_root(make_box(1));
+      CHECK(v->is_bound());
+      CHECK(equal(v->deref(), make_box(1)));
+      CHECK(equal(v->get_root(), make_box(1)));
+
+      auto const inc_fn(__rt_ctx->find_var("clojure.core", "inc").unwrap()->deref());
+      CHECK(equal(v->alter_root(inc_fn, obj::nil::nil_const()), make_box(2)));
+      CHECK(equal(v->deref(), make_box(2)));
+
+      SUBCASE("The fn can alter the same var")
+      {
+        auto const nested(__rt_ctx->eval_string(
+          "(fn [x] (alter-var-root #'clojure.core/var-test-root inc) (* x 10))"));
+        CHECK(equal(v->alter_root(nested, obj::nil::nil_const()), make_box(20)));
+        CHECK(equal(v->deref(), make_box(20)));
+      }
+
+      SUBCASE("Altering a pending root waits for it")
+      {
+        auto const generation(v->set_pending_root());
+        std::thread binder{ [&] {
+          util::gc_thread_scope const gc_thread;
+          v->bind_pending_root(make_box(5), generation);
+        } };
+        CHECK(equal(v->alter_root(inc_fn, obj::nil::nil_const()), make_box(6)));
+        binder.join();
+      }
+    }
+
+    TEST_CASE("thread binding")
+    {
+      auto const v(__rt_ctx->intern_var("clojure.core", "var-test-binding").expect_ok());
+      v->bind_root(make_box(1));
+      v->set_dynamic(true);
+      CHECK(v->set(make_box(5)).is_err());
+
+      __rt_ctx
+        ->push_thread_bindings(
+          obj::persistent_hash_map::create_unique(std::make_pair(v, make_box(2))))
+        .expect_ok();
+      CHECK(v->thread_bound.load());
+      CHECK(equal(v->deref(), make_box(2)));
+      CHECK(equal(v->get_root(), make_box(1)));
+
+      SUBCASE("Other threads see the root")
+      {
+        object_ptr other;
+        std::thread{ [&] {
+          util::gc_thread_scope const gc_thread;
+          other = v->deref();
+        } }.join();
+        CHECK(equal(other, make_box(1)));
+      }
+
+      CHECK(v->set(make_box(3)).is_ok());
+      CHECK(equal(v->deref(), make_box(3)));
+
+      __rt_ctx->pop_thread_bindings().expect_ok();
+      CHECK(equal(v->deref(), make_box(1)));
+    }
+
+    TEST_CASE("pending root")
+    {
+      auto const v(__rt_ctx->intern_var("clojure.core", "var-test-pending").expect_ok());
+      v->bind_root(make_box(1));
+      auto const generation(v->set_pending_root());
+      CHECK(v->is_pending_root());
+
+      object_ptr waited;
+      std::thread reader{ [&] {
+        util::gc_thread_scope const gc_thread;
+        waited = v->deref();
+      } };
+      CHECK(v->bind_pending_root(make_box(2), generation));
+      reader.join();
+      CHECK(!v->is_pending_root());
+      CHECK(equal(waited, make_box(2)));
+
+      SUBCASE("A bound root isn't replaced by the pending one")
+      {
+        auto const generation(v->set_pending_root());
+        v->bind_root(make_box(3));
+        CHECK(!v->bind_pending_root(make_box(4), generation));
+        CHECK(equal(v->deref(), make_box(3)));
+      }
+
+      SUBCASE("Only the latest pending root is bound")
+      {
+        auto const first(v->set_pending_root());
+        auto const second(v->set_pending_root());
+        CHECK(v->bind_pending_root(make_box(5), second));
+        CHECK(!v->bind_pending_root(make_box(6), first));
+        CHECK(equal(v->deref(), make_box(5)));
+      }
+    }
+
+    TEST_CASE("Readers while the root is rebound")
+    {
+      auto const v(__rt_ctx->intern_var("clojure.core", "var-test-readers").expect_ok());
+      object_ptr const one(make_box(1)), two(make_box(2));
+      v->bind_root(one);
+
+      std::atomic_bool done{};
+      std::atomic<size_t> torn{};
+      native_vector<std::thread> readers;
+      for(size_t t{}; t < 4; ++t)
+      {
+        readers.emplace_back([&] {
+          util::gc_thread_scope const gc_thread;
+          while(!done.load(std::memory_order_relaxed))
+          {
+            auto const r(v->deref());
+            if(r.data != one.data && r.data != two.data)
+            {
+              ++torn;
+            }
+          }
+        });
+      }
+
+      for(size_t i{}; i < 10'000; ++i)
+      {
+        v->bind_root(i % 2 ? one : two);
+      }
+      done.store(true);
+      for(auto &t : readers)
+      {
+        t.join();
+      }
+      CHECK(torn.load() == 0);
+    }
+  }
+}
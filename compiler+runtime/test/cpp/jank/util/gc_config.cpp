@@ -0,0 +1,34 @@
+#include <gc/gc.h>
+
+#include <jank/util/gc_config.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::util
+{
+  TEST_SUITE("gc_config")
+  {
+    TEST_CASE("stats")
+    {
+      configure_gc(cli::options{});
+      auto const before(get_gc_stats());
+
+      for(size_t i{}; i < 1000; ++i)
+      {
+        GC_MALLOC(1024);
+      }
+      GC_gcollect();
+
+      auto const after(get_gc_stats());
+      CHECK(before.collections < after.collections);
+      CHECK(before.bytes_allocated + before.bytes_since_collection + 1000 * 1024
+            <= after.bytes_allocated + after.bytes_since_collection);
+      CHECK(0 < after.heap_bytes);
+      CHECK(before.total_pause_ns < after.total_pause_ns);
+      CHECK(0 < after.max_pause_ns);
+      CHECK(after.max_pause_ns <= after.total_pause_ns);
+      CHECK(1 <= after.markers);
+    }
+  }
+}
@@ -25,6 +25,7 @@ try
 
   GC_set_all_interior_pointers(1);
   GC_enable();
+  GC_allow_register_threads();
 
   llvm::llvm_shutdown_obj const Y{};
 
@@ -45,6 +46,7 @@ try
     .expect_ok();
 
   auto const res(context.run());
+  jank::runtime::__rt_ctx->shutdown_executor();
   if(context.shouldExit())
   {
     return res;